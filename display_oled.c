@@ -5,6 +5,9 @@
 #include "pico/stdlib.h"
 #include "pico/binary_info.h"
 #include "inc/ssd1306.h"
+#include "inc/buttons.h"
+#include "inc/buzzer.h"
+#include "inc/pages.h"
 #include "hardware/i2c.h"
 #include "hardware/gpio.h"
 #include "hardware/pwm.h" // PWM para o buzzer (beep/alerta sonoro)
@@ -34,11 +37,19 @@ const uint I2C_SCL = 15;
 // Parâmetros de Interface
 // =============================
 
-// Debounce (anti-repique) em milissegundos
-#define DEBOUNCE_MS 180
+// Debounce (anti-repique), toque longo e repetição automática dos botões: ver inc/buttons.h
 
-// Altura de linha para fonte 5x7 (line height)
-#define LINE_H 8
+// Espera entre tentativas de envio de um quadro pendente, em milissegundos
+#define LOOP_MS 1
+
+// Modo de renderização:
+// 0 = core0 faz tudo; o quadro é enviado por DMA (ssd1306_present_async)
+// 1 = pipeline: o core1 é dono do barramento do display; o core0 só cuida de botões e buzzer
+#define DISPLAY_PIPELINE_MODE 0
+
+// Relatório da latência botão -> tela (via USB) a cada quadro entregue:
+// 0 = desligado (o printf no laço principal atrasa a leitura dos botões); 1 = ligado, para medições
+#define DISPLAY_LATENCY_REPORT 0
 
 /* ======================================================================
  * 2) CONTEÚDO DE UI (PÁGINAS) E ESTADO DE PAGINAÇÃO
@@ -47,27 +58,8 @@ const uint I2C_SCL = 15;
 // =============================
 // Conteúdo das páginas (UI)
 // =============================
-// Use '\n' (newline = nova linha) para quebrar linhas no OLED.
-static const char *PAGES[] = {
-    "              \n"
-    "|Bem vindo! |\n"
-    "|            |\n"
-    "|ALUNO    |\n"
-    "|            |\n"
-    "|TADS Info 2B|\n"
-    "              \n",
-
-    "Pagina 2\n\n"
-    "Com programacao \n\n"
-    "e robotica\n"
-    "                \n",
-
-    "Pagina 3\n\n"
-    "O ceu e limite.",
-
-    "Pagina 4\n\n"
-    "Obrigado"};
-static const int NUM_PAGES = (int)(sizeof(PAGES) / sizeof(PAGES[0]));
+// O texto das páginas (PAGES) fica em inc/pages.c, para que o build possa pré-renderizá-lo
+// no computador (tools/page_baker) e gravar os quadros prontos na flash.
 
 // Estado de paginação (page index = índice da página atual)
 static int current_page = 0;
@@ -80,164 +72,135 @@ static int current_page = 0;
 // Buzzer / Som (PWM)
 // =============================
 
-static uint buzzer_slice = 0; // slice do PWM associado ao pino do buzzer
-
-// Inicializa PWM no pino do buzzer.
-// Observação: para buzzer ATIVO, qualquer frequência audível funciona (geralmente já emite som).
-// Para buzzer PASSIVO, a frequência define o tom (pitch).
-static void buzzer_init(void)
-{
-    gpio_set_function(BUZZER_PIN, GPIO_FUNC_PWM);
-    buzzer_slice = pwm_gpio_to_slice_num(BUZZER_PIN);
-
-    // Deixe o PWM habilitado; ajustaremos TOP/nível na hora do beep.
-    pwm_set_enabled(buzzer_slice, true);
-}
-
-// Reproduz um tom (tone) por "ms" milissegundos com "duty" (0.0 a 1.0).
-// freq_hz: 400–4000 funciona bem para a maioria dos buzzers.
-// duty: ~0.3 (30%) costuma ser audível sem distorcer.
-static void play_tone(uint32_t freq_hz, uint16_t ms, float duty)
-{
-    if (freq_hz == 0)
-    {
-        sleep_ms(ms);
-        return;
-    }
-
-    // clk_sys tipicamente 125 MHz no RP2040
-    const uint32_t clk_sys = 125000000;
-    // Escolhemos um divisor de clock (clock divider) moderado para manter TOP dentro de 16 bits
-    float clk_div = 4.0f;
-    // Calcula TOP: f_pwm = clk_sys / (clk_div * (TOP + 1))
-    uint32_t top = (uint32_t)((float)clk_sys / (clk_div * (float)freq_hz)) - 1u;
-    if (top > 65535)
-    {
-        // Se extrapolar 16 bits, aumente o divisor e recalcule
-        clk_div = 16.0f;
-        top = (uint32_t)((float)clk_sys / (clk_div * (float)freq_hz)) - 1u;
-        if (top > 65535)
-        {
-            // Freq muito baixa — limita ao máximo possível
-            top = 65535;
-        }
-    }
-
-    pwm_set_clkdiv(buzzer_slice, clk_div);
-    pwm_set_wrap(buzzer_slice, top);
-
-    // Duty (nível) em counts
-    if (duty < 0.0f)
-        duty = 0.0f;
-    if (duty > 1.0f)
-        duty = 1.0f;
-    uint32_t level = (uint32_t)((float)top * duty);
-    pwm_set_gpio_level(BUZZER_PIN, level);
-
-    sleep_ms(ms);
-
-    // Silencia o buzzer
-    pwm_set_gpio_level(BUZZER_PIN, 0);
-}
+// O buzzer toca de forma assíncrona (inc/buzzer.c): os beeps retornam na hora,
+// sem travar a interface nem a leitura dos botões durante o som.
 
 // Beep distinto para "primeira página"
 static void beep_first_page(void)
 {
     // Tom mais grave (low) e curto
-    play_tone(500, 90, 0.35f);
+    static const buzzer_note_t beep[] = {{500, 90, 35}};
+    buzzer_play(beep, count_of(beep));
 }
 
 // Beep distinto para "última página"
 static void beep_last_page(void)
 {
     // Tom mais agudo (high) e curto
-    play_tone(1200, 90, 0.35f);
+    static const buzzer_note_t beep[] = {{1200, 90, 35}};
+    buzzer_play(beep, count_of(beep));
 }
 
 /* ======================================================================
- * 4) DESENHO DE TEXTO NO OLED (QUEBRA DE LINHA) E RENDERIZAÇÃO DE PÁGINA
+ * 4) RENDERIZAÇÃO DE PÁGINA (CORPO PRÉ-RENDERIZADO + RODAPÉ)
  * ====================================================================== */
 
-// Desenha múltiplas linhas no buffer (buffer = memória temporária para renderização)
-// Quebra o texto em '\n' e chama ssd1306_draw_string por linha.
-static void oled_println_buf(uint8_t *ssd, int x, int y, const char *text)
+// Rodapé (footer) na última linha útil (display 128x64 => y = 56), com a fonte proporcional:
+// instruções à esquerda e o indicador "página atual/total" à direita.
+// As instruções e o "/total" são diagramados uma vez; o número da página é um campo numérico,
+// que redesenha só os algarismos que mudaram (sem snprintf)
+static ssd1306_layout_t footer_hint;
+static ssd1306_layout_t footer_total;
+static ssd1306_number_field_t footer_page;
+static char footer_total_text[1 + ssd1306_field_max_cells + 1];
+
+static void footer_init(void)
 {
-    const char *start = text;
-    const char *p = text;
+    const ssd1306_font_t *font = &ssd1306_font_proportional;
 
-    char linebuf[128] = {0}; // buffer temporário de linha
+    ssd1306_layout_init(&footer_hint, font, 0, 56, 96, 8, ssd1306_align_left, false);
+    ssd1306_layout_set_text(&footer_hint, "A=Prox B=Voltar");
 
-    while (*p)
-    {
-        if (*p == '\n')
-        {
-            int len = (int)(p - start);
-            if (len > 0)
-            {
-                if (len >= (int)sizeof(linebuf))
-                    len = (int)sizeof(linebuf) - 1;
-                memcpy(linebuf, start, len);
-                linebuf[len] = '\0';
-                ssd1306_draw_string(ssd, x, y, linebuf);
-            }
-            // Próxima linha
-            y += LINE_H;
-            p++;
-            start = p;
-        }
-        else
-        {
-            p++;
-        }
-    }
+    footer_total_text[0] = '/';
+    footer_total_text[1 + ssd1306_format_fixed(&footer_total_text[1], NUM_PAGES, 0)] = '\0';
+    int total_width = ssd1306_measure_string(footer_total_text, font);
+    ssd1306_layout_init(&footer_total, font, ssd1306_width - total_width, 56, total_width, 8, ssd1306_align_right, false);
+    ssd1306_layout_set_text(&footer_total, footer_total_text);
 
-    // Última linha (se o texto não terminou com '\n')
-    if (p > start)
-    {
-        int len = (int)(p - start);
-        if (len >= (int)sizeof(linebuf))
-            len = (int)sizeof(linebuf) - 1;
-        memcpy(linebuf, start, len);
-        linebuf[len] = '\0';
-        ssd1306_draw_string(ssd, x, y, linebuf);
-    }
+    // Até 2 algarismos, encostados no "/total"
+    ssd1306_number_field_init(&footer_page, font, 0, 56, 2, 0);
+    footer_page.x = ssd1306_width - total_width - font->spacing - ssd1306_number_field_width(&footer_page);
 }
 
-// Renderiza a página atual:
-// - Limpa o buffer (clear)
-// - Desenha o corpo (body) do texto
+// Renderiza a página atual no buffer de desenho (back buffer ou quadro do pipeline):
+// - Copia o corpo (body) já rasterizado (quadro pré-renderizado na flash ou no cache, ver inc/pages.c)
 // - Desenha rodapé (footer) com instruções e indicador "página atual/total"
-// - Envia para o display (render_on_display)
-static void render_page(uint8_t *ssd, struct render_area *area, int page_index)
+// fresh indica um buffer limpo (sem o rodapé anterior): aí o rodapé é desenhado por inteiro;
+// senão só os algarismos do número da página que mudaram.
+// O envio ao display (somente dos bytes que mudaram) é feito depois, por submit_frame,
+// então o display nunca chega a mostrar a tela limpa no meio do redesenho
+static void render_page(uint8_t *ssd, int page_index, bool fresh)
 {
-    // Zera o display inteiro (limpa o buffer de vídeo)
-    memset(ssd, 0, ssd1306_buffer_length);
+    // Corpo pré-renderizado da página (não toca na linha do rodapé)
+    pages_draw_body(ssd, page_index);
+
+    if (fresh)
+    {
+        ssd1306_layout_draw(ssd, &footer_hint, ssd1306_draw_opaque);
+        ssd1306_layout_draw(ssd, &footer_total, ssd1306_draw_opaque);
+        ssd1306_number_field_invalidate(&footer_page);
+    }
+    ssd1306_number_field_set(ssd, &footer_page, page_index + 1);
+}
 
-    // Corpo da página (margem esquerda = 5 px, topo = 0)
-    oled_println_buf(ssd, 5, 0, PAGES[page_index]);
+// =============================
+// Envio do quadro e latência (botão -> tela)
+// =============================
 
-    // Rodapé (footer) com instruções e indicador numérico
-    char footer[32];
-    snprintf(footer, sizeof(footer), "A=Prox B=Voltar  %d/%d", page_index + 1, NUM_PAGES);
-    // Desenha rodapé na última linha útil (display 128x64 => y = 56)
-    ssd1306_draw_string(ssd, 0, 56, footer);
+#if !DISPLAY_PIPELINE_MODE
+// Buffers de vídeo (framebuffer = imagem em memória): back para desenhar, front com o que está no display
+static ssd1306_double_buffer_t display;
+static ssd1306_latency_t display_latency;
+static uint32_t frame_start_us;
 
-    // Atualiza o display físico (show/update)
-    render_on_display(ssd, area);
+// Chamada (numa interrupção) quando o último byte do quadro saiu pelo barramento: FIFO do I2C vazio e
+// STOP enviado, o mesmo ponto medido no modo pipeline (após o ssd1306_present bloqueante)
+static void frame_sent(void *user_data)
+{
+    ssd1306_latency_record(&display_latency, *(uint32_t *)user_data);
 }
+#endif
 
-/* ======================================================================
- * 5) ENTRADA (BOTÕES) E UTILITÁRIOS
- * ====================================================================== */
+// Desenha a página e a envia ao display sem bloquear.
+// start_us: instante do evento que originou o quadro (para medir a latência botão -> tela).
+// Retorna false se o quadro anterior ainda estiver em envio (tente de novo na próxima volta do loop).
+static bool submit_frame(int page_index, uint32_t start_us)
+{
+#if DISPLAY_PIPELINE_MODE
+    uint8_t *ssd = ssd1306_pipeline_begin_frame();
+    if (!ssd)
+        return false;
+
+    // Os quadros do pipeline chegam zerados
+    render_page(ssd, page_index, true);
+    return ssd1306_pipeline_submit(start_us);
+#else
+    if (ssd1306_async_busy())
+        return false;
+
+    // O back buffer guarda o rodapé do quadro anterior (só é limpo antes do primeiro)
+    static bool footer_drawn = false;
+    render_page(display.back.data, page_index, !footer_drawn);
+    footer_drawn = true;
+    frame_start_us = start_us;
+    return ssd1306_present_async(&display, frame_sent, &frame_start_us);
+#endif
+}
 
-// Retorna true (verdadeiro) se o botão (com pull-up) estiver pressionado (nível LOW/baixo).
-static inline bool button_pressed(uint pin)
+#if DISPLAY_LATENCY_REPORT
+// Latência acumulada do modo atual
+static ssd1306_latency_t *frame_latency(void)
 {
-    return gpio_get(pin) == 0;
+#if DISPLAY_PIPELINE_MODE
+    return ssd1306_pipeline_latency();
+#else
+    return &display_latency;
+#endif
 }
+#endif
 
 /* ======================================================================
- * 6) SETUP (INICIALIZAÇÃO) E LOOP PRINCIPAL
+ * 5) SETUP (INICIALIZAÇÃO) E LOOP PRINCIPAL
  * ====================================================================== */
 
 // =============================
@@ -267,45 +230,62 @@ int main(void)
         .end_page = ssd1306_n_pages - 1};
     calculate_render_area_buffer_length(&frame_area);
 
-    // Buffer de vídeo (framebuffer = imagem em memória)
-    static uint8_t ssd[ssd1306_buffer_length];
-    memset(ssd, 0, ssd1306_buffer_length);
-    render_on_display(ssd, &frame_area);
+    // Apaga o display inteiro
+    static ssd1306_framebuffer_t blank;
+    ssd1306_framebuffer_init(&blank);
+    render_framebuffer_on_display(&blank, &frame_area);
 
-    // --- Botões A (avança) e B (volta) ---
-    gpio_init(BUTTON_A_PIN);
-    gpio_set_dir(BUTTON_A_PIN, GPIO_IN);
-    gpio_pull_up(BUTTON_A_PIN);
+#if DISPLAY_PIPELINE_MODE
+    // Serviço de display no core1 (a partir daqui, só o core1 usa o barramento do display)
+    ssd1306_pipeline_init();
+#else
+    // Envio assíncrono do framebuffer via DMA (a CPU fica livre durante a transferência I2C)
+    ssd1306_double_buffer_init(&display);
+    ssd1306_async_init(NULL);
+#endif
 
-    gpio_init(BUTTON_B_PIN);
-    gpio_set_dir(BUTTON_B_PIN, GPIO_IN);
-    gpio_pull_up(BUTTON_B_PIN);
+    // --- Botões A (avança) e B (volta), por interrupção ---
+    const uint button_pins[] = {BUTTON_A_PIN, BUTTON_B_PIN};
+    buttons_init(button_pins, count_of(button_pins));
 
     // --- Buzzer ---
-    buzzer_init();
-
-    // Primeiro desenho (render) na tela
-    render_page(ssd, &frame_area, current_page);
+    buzzer_init(BUZZER_PIN);
+
+    // Prepara o corpo das páginas (a troca de página passa a ser só uma cópia) e diagrama o rodapé
+    pages_init();
+    footer_init();
+
+    // Primeiro desenho (render) na tela: fica pendente até ser enviado pelo loop
+    bool frame_pending = true;
+    uint32_t frame_event_us = time_us_32();
+#if DISPLAY_LATENCY_REPORT
+    uint32_t reported_frames = 0;
+#endif
     // Se iniciar já na primeira/última, pode tocar um beep informativo (opcional):
     beep_first_page();
 
-    // Controle de debounce por tempo
-    absolute_time_t last_change = get_absolute_time();
-
     while (true)
     {
         bool updated = false;
+        button_event_t event;
 
-        // Avançar (A / next)
-        if (button_pressed(BUTTON_A_PIN))
+        // Trata todos os eventos de botão acumulados (o debounce já foi feito nas interrupções)
+        while (buttons_get_event(&event))
         {
-            if (absolute_time_diff_us(last_change, get_absolute_time()) / 1000 > DEBOUNCE_MS)
+            // Muda de página ao pressionar e, segurando, a cada repetição automática
+            if (event.type == BUTTON_EVENT_RELEASE)
+                continue;
+            bool first_press = (event.type == BUTTON_EVENT_PRESS);
+
+            // Avançar (A / next)
+            if (event.pin == BUTTON_A_PIN)
             {
                 if (current_page < NUM_PAGES - 1)
                 {
                     // Vai avançar de fato
                     current_page++;
                     updated = true;
+                    frame_event_us = event.time_us;
 
                     // *** REQUISITO: tocar SOM AO CHEGAR NA ÚLTIMA PÁGINA ***
                     // if (current_page == (NUM_PAGES - 1))
@@ -313,42 +293,38 @@ int main(void)
                     //     beep_last_page(); // chegou agora na última
                     // }
                 }
-                else
+                else if (first_press)
                 {
                     // *** REQUISITO: se JÁ ESTIVER na ÚLTIMA e apertar A, tocar som ***
                     beep_last_page();
                 }
-                last_change = get_absolute_time();
             }
-        }
-        // Voltar (B / previous)
-        else if (button_pressed(BUTTON_B_PIN))
-        {
-            if (absolute_time_diff_us(last_change, get_absolute_time()) / 1000 > DEBOUNCE_MS)
+            // Voltar (B / previous)
+            else if (event.pin == BUTTON_B_PIN)
             {
                 if (current_page > 0)
                 {
                     // Vai voltar de fato
                     current_page--;
                     updated = true;
+                    frame_event_us = event.time_us;
 
                     // (Observação): o requisito NÃO pede som ao CHEGAR na primeira.
                     // Se você quiser som ao chegar na primeira, descomente:
                     // if (current_page == 0) { beep_first_page(); }
                 }
-                else
+                else if (first_press)
                 {
                     // *** REQUISITO: se JÁ ESTIVER na PRIMEIRA e apertar B, tocar som ***
                     beep_first_page();
                 }
-                last_change = get_absolute_time();
             }
         }
 
-        // Se houve mudança de página, renderiza (desenha) a página atual
+        // Se houve mudança de página, marca o quadro da página atual como pendente de envio
         if (updated)
         {
-            render_page(ssd, &frame_area, current_page);
+            frame_pending = true;
 
             // Observação importante:
             // Antes, havia um beep aqui ao "chegar" nas extremidades (incluindo a primeira).
@@ -358,8 +334,32 @@ int main(void)
             //  - NÃO tocar beep automaticamente ao chegar na PRIMEIRA (a menos que você queira).
         }
 
-        // Pequena pausa (sleep) para aliviar CPU (loop = laço)
-        sleep_ms(10);
+        // Atualiza o display físico (show/update) com os bytes que mudaram, sem bloquear:
+        // se ainda houver um envio em andamento, o quadro fica pendente para a próxima volta
+        if (frame_pending && submit_frame(current_page, frame_event_us))
+        {
+            frame_pending = false;
+        }
+
+#if DISPLAY_LATENCY_REPORT
+        // Mostra (via USB) a latência botão -> tela a cada quadro entregue
+        // A cópia é consistente mesmo que o DMA (ou o core1) registre um quadro no meio da leitura
+        ssd1306_latency_t latency;
+        ssd1306_latency_read(frame_latency(), &latency);
+        if (latency.frames != reported_frames)
+        {
+            reported_frames = latency.frames;
+            printf("latencia botao->tela: %lu us (max %lu us, media %lu us)\n",
+                   (unsigned long)latency.last_us, (unsigned long)latency.max_us,
+                   (unsigned long)(latency.total_us / reported_frames));
+        }
+#endif
+
+        // Dorme até a próxima interrupção (botão, DMA...). Com quadro pendente, só espera um pouco e tenta de novo.
+        if (frame_pending)
+            sleep_ms(LOOP_MS);
+        else
+            buttons_wait_event();
     }
 
     return 0;
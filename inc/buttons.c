@@ -0,0 +1,158 @@
+#include "pico/stdlib.h"
+#include "hardware/gpio.h"
+#include "hardware/sync.h"
+#include "buttons.h"
+
+// Entrada por interrupção: cada borda no pino (re)agenda um alarme de debounce;
+// quando o nível fica estável por BUTTON_DEBOUNCE_MS, o alarme gera PRESS/RELEASE na fila.
+// Enquanto o botão segue pressionado, um segundo alarme gera LONG_PRESS e depois REPEAT.
+
+typedef struct {
+    uint pin;
+    volatile bool pressed;          // Estado estável (após o debounce)
+    volatile bool debounce_pending; // Há um alarme de debounce agendado
+    volatile uint32_t first_edge_us;
+    volatile uint32_t last_edge_us;
+    bool long_pressed;
+    alarm_id_t hold_alarm;
+} button_t;
+
+static button_t buttons[BUTTON_MAX_BUTTONS];
+static int button_count = 0;
+
+// Fila de eventos: produtor = interrupções (GPIO/alarmes), consumidor = loop principal
+static button_event_t queue[BUTTON_QUEUE_SIZE];
+static volatile uint32_t queue_head = 0;
+static volatile uint32_t queue_tail = 0;
+
+static void buttons_push(button_t *button, button_event_type_t type, uint32_t time_us) {
+    if (queue_head - queue_tail == BUTTON_QUEUE_SIZE) {
+        return; // Fila cheia: descarta o evento mais novo
+    }
+
+    button_event_t *event = &queue[queue_head % BUTTON_QUEUE_SIZE];
+    event->pin = button->pin;
+    event->type = type;
+    event->time_us = time_us;
+    __compiler_memory_barrier();
+    queue_head++;
+}
+
+// Toque longo e repetição automática
+static int64_t buttons_hold_callback(alarm_id_t id, void *user_data) {
+    button_t *button = user_data;
+
+    if (!button->pressed) {
+        button->hold_alarm = 0;
+        return 0;
+    }
+
+    buttons_push(button, button->long_pressed ? BUTTON_EVENT_REPEAT : BUTTON_EVENT_LONG_PRESS, time_us_32());
+    button->long_pressed = true;
+
+    // Positivo: reagenda em relação ao disparo anterior (cadência estável)
+    return BUTTON_REPEAT_MS * 1000;
+}
+
+// Debounce: só aceita o novo nível depois de BUTTON_DEBOUNCE_MS sem bordas
+static int64_t buttons_debounce_callback(alarm_id_t id, void *user_data) {
+    button_t *button = user_data;
+    uint32_t quiet_us = time_us_32() - button->last_edge_us;
+
+    if (quiet_us < BUTTON_DEBOUNCE_MS * 1000) {
+        // Negativo: reagenda em relação a agora
+        return -(int64_t)(BUTTON_DEBOUNCE_MS * 1000 - quiet_us);
+    }
+
+    button->debounce_pending = false;
+
+    bool pressed = !gpio_get(button->pin); // Pull-up: pressionado = nível baixo
+    if (pressed == button->pressed) {
+        return 0; // Repique que voltou ao nível anterior
+    }
+    button->pressed = pressed;
+
+    if (pressed) {
+        buttons_push(button, BUTTON_EVENT_PRESS, button->first_edge_us);
+        button->long_pressed = false;
+        button->hold_alarm = add_alarm_in_ms(BUTTON_LONG_PRESS_MS, buttons_hold_callback, button, true);
+    }
+    else {
+        buttons_push(button, BUTTON_EVENT_RELEASE, button->first_edge_us);
+        if (button->hold_alarm > 0) {
+            cancel_alarm(button->hold_alarm);
+            button->hold_alarm = 0;
+        }
+    }
+
+    return 0;
+}
+
+static void buttons_gpio_callback(uint gpio, uint32_t event_mask) {
+    uint32_t now = time_us_32();
+
+    for (int i = 0; i < button_count; i++) {
+        button_t *button = &buttons[i];
+        if (button->pin != gpio) {
+            continue;
+        }
+
+        button->last_edge_us = now;
+        if (!button->debounce_pending) {
+            button->debounce_pending = true;
+            button->first_edge_us = now;
+            add_alarm_in_ms(BUTTON_DEBOUNCE_MS, buttons_debounce_callback, button, true);
+        }
+        break;
+    }
+}
+
+// Configura os pinos (entrada com pull-up, pressionado = nível baixo) e as interrupções de borda
+void buttons_init(const uint *pins, int count) {
+    if (count > BUTTON_MAX_BUTTONS) {
+        count = BUTTON_MAX_BUTTONS;
+    }
+
+    for (int i = 0; i < count; i++) {
+        button_t *button = &buttons[i];
+
+        gpio_init(pins[i]);
+        gpio_set_dir(pins[i], GPIO_IN);
+        gpio_pull_up(pins[i]);
+
+        button->pin = pins[i];
+        button->pressed = !gpio_get(pins[i]);
+        button->debounce_pending = false;
+        button->long_pressed = false;
+        button->hold_alarm = 0;
+    }
+    button_count = count;
+
+    for (int i = 0; i < count; i++) {
+        gpio_set_irq_enabled_with_callback(pins[i], GPIO_IRQ_EDGE_FALL | GPIO_IRQ_EDGE_RISE, true, buttons_gpio_callback);
+    }
+}
+
+// Retira o próximo evento da fila; retorna false se não houver
+bool buttons_get_event(button_event_t *event) {
+    if (queue_tail == queue_head) {
+        return false;
+    }
+
+    *event = queue[queue_tail % BUTTON_QUEUE_SIZE];
+    __compiler_memory_barrier();
+    queue_tail++;
+    return true;
+}
+
+// Dorme (__wfi) até chegar um evento. Qualquer outra interrupção também acorda o core,
+// então o chamador deve tratar o retorno sem evento na fila.
+void buttons_wait_event() {
+    // Com as interrupções mascaradas, uma interrupção pendente ainda acorda o __wfi,
+    // evitando dormir se o evento chegar entre a verificação e o __wfi
+    uint32_t status = save_and_disable_interrupts();
+    if (queue_tail == queue_head) {
+        __wfi();
+    }
+    restore_interrupts(status);
+}
@@ -0,0 +1,38 @@
+#include "pico/stdlib.h"
+
+#ifndef buttons_inc_h
+#define buttons_inc_h
+
+#ifndef BUTTON_DEBOUNCE_MS
+#define BUTTON_DEBOUNCE_MS 20 // Tempo que o nível precisa ficar estável para valer (anti-repique)
+#endif
+
+#ifndef BUTTON_LONG_PRESS_MS
+#define BUTTON_LONG_PRESS_MS 500 // Tempo segurando até gerar BUTTON_EVENT_LONG_PRESS
+#endif
+
+#ifndef BUTTON_REPEAT_MS
+#define BUTTON_REPEAT_MS 180 // Intervalo das repetições automáticas depois do toque longo
+#endif
+
+#define BUTTON_MAX_BUTTONS 4
+#define BUTTON_QUEUE_SIZE 16 // Potência de 2
+
+typedef enum {
+    BUTTON_EVENT_PRESS,
+    BUTTON_EVENT_RELEASE,
+    BUTTON_EVENT_LONG_PRESS,
+    BUTTON_EVENT_REPEAT,
+} button_event_type_t;
+
+typedef struct {
+    uint8_t pin;
+    uint8_t type;     // button_event_type_t
+    uint32_t time_us; // Instante da primeira borda (PRESS/RELEASE) ou do disparo (LONG_PRESS/REPEAT)
+} button_event_t;
+
+extern void buttons_init(const uint *pins, int count);
+extern bool buttons_get_event(button_event_t *event);
+extern void buttons_wait_event();
+
+#endif
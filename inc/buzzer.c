@@ -0,0 +1,211 @@
+#include "pico/stdlib.h"
+#include "hardware/gpio.h"
+#include "hardware/pwm.h"
+#include "hardware/sync.h"
+#include "hardware/clocks.h"
+#include "buzzer.h"
+
+// Tocador assíncrono: buzzer_play calcula os valores de PWM de todas as notas e retorna na hora;
+// um alarme do timer aplica cada nota no seu instante, sem sleep_ms e sem custo no loop principal.
+
+static uint buzzer_pin;
+static uint buzzer_slice;
+static uint32_t buzzer_clock_hz = BUZZER_TABLE_CLOCK_HZ;
+
+// Configuração de PWM de um tom, só com inteiros:
+// f = clk / ((div16 / 16) * (wrap + 1)), com div16 = divisor em ponto fixo 8.4 (16 a 4095)
+// Alvo: div16 * (wrap + 1) ≈ 16 * clk / f. O menor divisor que mantém wrap em 16 bits
+// dá a maior resolução de TOP, e o arredondamento de wrap limita o erro a div16 / 2 contagens.
+#define BUZZER_TONE_TARGET(clk, f) ((((uint64_t)(clk) << 4) + (f) / 2) / (f))
+#define BUZZER_TONE_DIV16(clk, f) \
+    (BUZZER_TONE_TARGET(clk, f) <= 16u * 65536u ? 16u : (BUZZER_TONE_TARGET(clk, f) + 65535u) / 65536u)
+#define BUZZER_TONE_WRAP(clk, f) \
+    ((BUZZER_TONE_TARGET(clk, f) + BUZZER_TONE_DIV16(clk, f) / 2) / BUZZER_TONE_DIV16(clk, f) - 1u)
+
+#define BUZZER_TONE_ENTRY(f) \
+    { (f), BUZZER_TONE_DIV16(BUZZER_TABLE_CLOCK_HZ, f), BUZZER_TONE_WRAP(BUZZER_TABLE_CLOCK_HZ, f) }
+
+// Tons pré-calculados em tempo de compilação (em flash), ordenados por frequência
+static const struct {
+    uint16_t freq_hz;
+    uint16_t div16;
+    uint16_t wrap;
+} tone_table[] = {
+    BUZZER_TONE_ENTRY(NOTE_C4), BUZZER_TONE_ENTRY(NOTE_D4), BUZZER_TONE_ENTRY(NOTE_E4),
+    BUZZER_TONE_ENTRY(NOTE_F4), BUZZER_TONE_ENTRY(NOTE_G4), BUZZER_TONE_ENTRY(NOTE_A4),
+    BUZZER_TONE_ENTRY(NOTE_B4), BUZZER_TONE_ENTRY(500), BUZZER_TONE_ENTRY(NOTE_C5),
+    BUZZER_TONE_ENTRY(NOTE_D5), BUZZER_TONE_ENTRY(NOTE_E5), BUZZER_TONE_ENTRY(NOTE_F5),
+    BUZZER_TONE_ENTRY(NOTE_G5), BUZZER_TONE_ENTRY(NOTE_A5), BUZZER_TONE_ENTRY(NOTE_B5),
+    BUZZER_TONE_ENTRY(1000), BUZZER_TONE_ENTRY(NOTE_C6), BUZZER_TONE_ENTRY(1200),
+    BUZZER_TONE_ENTRY(NOTE_E6), BUZZER_TONE_ENTRY(NOTE_G6), BUZZER_TONE_ENTRY(2000),
+    BUZZER_TONE_ENTRY(NOTE_C7), BUZZER_TONE_ENTRY(4000),
+};
+
+// Calcula div16 e wrap para freq_hz com o clock informado (mesma regra da tabela)
+// Retorna a frequência obtida, arredondada para Hz (0 se freq_hz for 0)
+uint32_t buzzer_tone_config(uint32_t clk_hz, uint32_t freq_hz, uint16_t *div16, uint16_t *wrap) {
+    if (freq_hz == 0) {
+        *div16 = 16;
+        *wrap = 0;
+        return 0;
+    }
+
+    uint64_t target = BUZZER_TONE_TARGET(clk_hz, freq_hz);
+    uint64_t div = BUZZER_TONE_DIV16(clk_hz, freq_hz);
+    if (div > 4095) {
+        div = 4095; // Freq muito baixa: divisor máximo (255 + 15/16)
+    }
+
+    uint64_t counts = (target + div / 2) / div;
+    if (counts > 65536) {
+        counts = 65536;
+    }
+
+    *div16 = div;
+    *wrap = counts - 1;
+
+    uint64_t period = div * counts;
+    return (((uint64_t)clk_hz << 4) + period / 2) / period;
+}
+
+// Procura o tom na tabela pré-calculada (busca binária); retorna false se não estiver lá
+static bool buzzer_tone_lookup(uint32_t freq_hz, uint16_t *div16, uint16_t *wrap) {
+    int low = 0;
+    int high = count_of(tone_table) - 1;
+
+    while (low <= high) {
+        int mid = (low + high) / 2;
+        if (tone_table[mid].freq_hz == freq_hz) {
+            *div16 = tone_table[mid].div16;
+            *wrap = tone_table[mid].wrap;
+            return true;
+        }
+        if (tone_table[mid].freq_hz < freq_hz) {
+            low = mid + 1;
+        }
+        else {
+            high = mid - 1;
+        }
+    }
+    return false;
+}
+
+static buzzer_step_t steps[BUZZER_MAX_NOTES];
+static volatile int step_count = 0;
+static volatile int step_index = 0;
+static alarm_id_t step_alarm = 0;
+
+// Calcula divisor, TOP (wrap) e nível de uma nota (tabela pré-calculada ou cálculo inteiro)
+void buzzer_prepare_step(const buzzer_note_t *note, buzzer_step_t *step) {
+    step->duration_us = note->duration_ms * 1000u;
+
+    if (note->freq_hz == 0) {
+        // Pausa: mantém a configuração anterior e só zera o nível
+        step->div_int = 0;
+        step->div_frac = 0;
+        step->wrap = 0;
+        step->level = 0;
+        return;
+    }
+
+    uint16_t div16;
+    uint16_t wrap;
+    if (buzzer_clock_hz != BUZZER_TABLE_CLOCK_HZ || !buzzer_tone_lookup(note->freq_hz, &div16, &wrap)) {
+        buzzer_tone_config(buzzer_clock_hz, note->freq_hz, &div16, &wrap);
+    }
+
+    uint32_t duty = note->duty_percent > 100 ? 100 : note->duty_percent;
+
+    step->div_int = div16 >> 4;
+    step->div_frac = div16 & 0x0F;
+    step->wrap = wrap;
+    step->level = (wrap + 1u) * duty / 100u;
+}
+
+// Aplica uma nota no PWM (poucas escritas em registradores)
+static void buzzer_apply(const buzzer_step_t *step) {
+    if (step->div_int) {
+        pwm_set_clkdiv_int_frac(buzzer_slice, step->div_int, step->div_frac);
+        pwm_set_wrap(buzzer_slice, step->wrap);
+    }
+    pwm_set_gpio_level(buzzer_pin, step->level);
+}
+
+// Alarme: avança para a próxima nota ou silencia ao fim da sequência
+static int64_t buzzer_alarm_callback(alarm_id_t id, void *user_data) {
+    int next = step_index + 1;
+
+    if (next >= step_count) {
+        pwm_set_gpio_level(buzzer_pin, 0);
+        step_count = 0;
+        step_alarm = 0;
+        return 0;
+    }
+
+    step_index = next;
+    buzzer_apply(&steps[next]);
+
+    // Positivo: reagenda em relação ao disparo anterior (as durações não acumulam atraso)
+    return steps[next].duration_us;
+}
+
+// Inicializa PWM no pino do buzzer.
+// Observação: para buzzer ATIVO, qualquer frequência audível funciona (geralmente já emite som).
+// Para buzzer PASSIVO, a frequência define o tom (pitch).
+void buzzer_init(uint pin) {
+    buzzer_pin = pin;
+    buzzer_clock_hz = clock_get_hz(clk_sys);
+    gpio_set_function(pin, GPIO_FUNC_PWM);
+    buzzer_slice = pwm_gpio_to_slice_num(pin);
+
+    // Deixe o PWM habilitado; o nível fica em 0 (silêncio) fora das notas
+    pwm_set_gpio_level(pin, 0);
+    pwm_set_enabled(buzzer_slice, true);
+}
+
+// Interrompe a sequência em andamento e silencia o buzzer
+void buzzer_stop() {
+    uint32_t status = save_and_disable_interrupts();
+    if (step_alarm > 0) {
+        cancel_alarm(step_alarm);
+        step_alarm = 0;
+    }
+    step_count = 0;
+    restore_interrupts(status);
+
+    pwm_set_gpio_level(buzzer_pin, 0);
+}
+
+// Toca uma sequência de notas sem bloquear (substitui a sequência em andamento)
+// Retorna false se a sequência estiver vazia ou não houver alarme livre
+bool buzzer_play(const buzzer_note_t *notes, int count) {
+    buzzer_stop();
+
+    if (count <= 0) {
+        return false;
+    }
+    if (count > BUZZER_MAX_NOTES) {
+        count = BUZZER_MAX_NOTES;
+    }
+
+    for (int i = 0; i < count; i++) {
+        buzzer_prepare_step(&notes[i], &steps[i]);
+    }
+    step_index = 0;
+    step_count = count;
+
+    buzzer_apply(&steps[0]);
+    // 0: o instante já tinha passado e o alarme disparou na hora, até o fim da sequência (não é falha)
+    // Negativo: não há alarme livre
+    step_alarm = add_alarm_in_us(steps[0].duration_us, buzzer_alarm_callback, NULL, true);
+    if (step_alarm < 0) {
+        buzzer_stop();
+        return false;
+    }
+    return true;
+}
+
+// Indica se ainda há uma sequência tocando
+bool buzzer_busy() {
+    return step_count != 0;
+}
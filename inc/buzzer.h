@@ -0,0 +1,54 @@
+#include "pico/stdlib.h"
+
+#ifndef buzzer_inc_h
+#define buzzer_inc_h
+
+#define BUZZER_MAX_NOTES 16 // Notas por sequência
+
+// Clock para o qual a tabela de tons pré-calculados (buzzer.c) foi gerada; com outro clk_sys, calcula na hora
+#define BUZZER_TABLE_CLOCK_HZ 125000000u
+
+// Notas comuns (Hz, arredondadas), presentes na tabela pré-calculada
+#define NOTE_C4 262
+#define NOTE_D4 294
+#define NOTE_E4 330
+#define NOTE_F4 349
+#define NOTE_G4 392
+#define NOTE_A4 440
+#define NOTE_B4 494
+#define NOTE_C5 523
+#define NOTE_D5 587
+#define NOTE_E5 659
+#define NOTE_F5 698
+#define NOTE_G5 784
+#define NOTE_A5 880
+#define NOTE_B5 988
+#define NOTE_C6 1047
+#define NOTE_E6 1319
+#define NOTE_G6 1568
+#define NOTE_C7 2093
+
+// Uma nota da sequência; freq_hz = 0 é uma pausa (silêncio) com a mesma duração
+typedef struct {
+    uint16_t freq_hz;
+    uint16_t duration_ms;
+    uint8_t duty_percent; // ~30-40% costuma ser audível sem distorcer
+} buzzer_note_t;
+
+// Valores de PWM já calculados para uma nota (aplicados na interrupção do alarme)
+typedef struct {
+    uint8_t div_int;
+    uint8_t div_frac;
+    uint16_t wrap;
+    uint16_t level;
+    uint32_t duration_us;
+} buzzer_step_t;
+
+extern void buzzer_init(uint pin);
+extern uint32_t buzzer_tone_config(uint32_t clk_hz, uint32_t freq_hz, uint16_t *div16, uint16_t *wrap);
+extern void buzzer_prepare_step(const buzzer_note_t *note, buzzer_step_t *step);
+extern bool buzzer_play(const buzzer_note_t *notes, int count);
+extern void buzzer_stop();
+extern bool buzzer_busy();
+
+#endif
@@ -0,0 +1,90 @@
+#include <string.h>
+#include <assert.h>
+#include "pico/stdlib.h"
+#include "hardware/i2c.h"
+#include "ssd1306.h"
+#include "pages.h"
+
+// Use '\n' (newline = nova linha) para quebrar linhas no OLED.
+const char *const PAGES[] = {
+    "              \n"
+    "|Bem vindo! |\n"
+    "|            |\n"
+    "|ALUNO    |\n"
+    "|            |\n"
+    "|TADS Info 2B|\n"
+    "              \n",
+
+    "Pagina 2\n\n"
+    "Com programacao \n\n"
+    "e robotica\n"
+    "                \n",
+
+    "Pagina 3\n\n"
+    "O ceu e limite.",
+
+    "Pagina 4\n\n"
+    "Obrigado"};
+const int NUM_PAGES = (int)count_of(PAGES);
+
+// Altura de linha para fonte 5x7 (line height)
+#define LINE_H 8
+
+// Desenha múltiplas linhas no buffer (buffer = memória temporária para renderização)
+// Quebra o texto em '\n' e, se a linha não couber na largura da tela, no último espaço;
+// cada linha é desenhada direto do texto original (sem cópia) e o que passar do fim da tela é descartado
+static void oled_println_buf(uint8_t *ssd, int x, int y, const char *text) {
+    ssd1306_text_lines_t lines;
+    const char *line;
+    size_t length;
+
+    ssd1306_text_lines_init(&lines, text, &ssd1306_font_8x8, ssd1306_width - x);
+
+    while (y < ssd1306_height && ssd1306_text_lines_next(&lines, &line, &length)) {
+        ssd1306_draw_string_n(ssd, x, y, line, length);
+        // Próxima linha
+        y += LINE_H;
+    }
+}
+
+// Rasteriza o corpo (texto estático) de uma página num quadro limpo (margem esquerda = 5 px, topo = 0)
+// É o mesmo código que o tools/page_baker executa no computador para gerar os quadros da flash
+void pages_render_body(uint8_t *ssd, int page_index) {
+    memset(ssd, 0, ssd1306_buffer_length);
+    oled_println_buf(ssd, 5, 0, PAGES[page_index]);
+}
+
+#ifdef PAGES_BAKED
+// Quadros gerados no build por tools/page_baker (ver CMakeLists.txt): ficam na flash, sem RAM e sem renderizar
+#include "pages_baked.h"
+
+static_assert(count_of(PAGES) == count_of(pages_baked_offsets) - 1, "pages_baked.h desatualizado");
+
+void pages_init() {
+}
+
+// Copia (ou descompacta, se gerado com RLE) o corpo pronto da página direto da flash
+// Só as páginas do corpo são escritas: o rodapé que já estiver no buffer é preservado
+void pages_draw_body(uint8_t *ssd, int page_index) {
+    const uint8_t *frame = &pages_baked_data[pages_baked_offsets[page_index]];
+#if PAGES_BAKED_RLE
+    ssd1306_rle_decode(frame, ssd, PAGES_BODY_LENGTH);
+#else
+    memcpy(ssd, frame, PAGES_BODY_LENGTH);
+#endif
+}
+#else
+// Sem os quadros gerados no build: o corpo de cada página é rasterizado uma única vez, na inicialização,
+// e a navegação só copia o quadro pronto (1 KB por página, em RAM)
+static uint8_t page_cache[count_of(PAGES)][ssd1306_buffer_length];
+
+void pages_init() {
+    for (int i = 0; i < NUM_PAGES; i++) {
+        pages_render_body(page_cache[i], i);
+    }
+}
+
+void pages_draw_body(uint8_t *ssd, int page_index) {
+    memcpy(ssd, page_cache[page_index], PAGES_BODY_LENGTH);
+}
+#endif
@@ -0,0 +1,17 @@
+#include "pico/stdlib.h"
+
+#ifndef pages_inc_h
+#define pages_inc_h
+
+// Conteúdo estático das páginas da interface ('\n' quebra a linha no OLED)
+extern const char *const PAGES[];
+extern const int NUM_PAGES;
+
+// O corpo ocupa as primeiras páginas (linhas de 8 px) da tela; a última (y = 56) fica para o rodapé
+#define PAGES_BODY_LENGTH ((ssd1306_n_pages - 1) * ssd1306_width)
+
+extern void pages_init();
+extern void pages_render_body(uint8_t *ssd, int page_index);
+extern void pages_draw_body(uint8_t *ssd, int page_index);
+
+#endif
@@ -2,16 +2,118 @@
 extern void calculate_render_area_buffer_length(struct render_area *area);
 extern void ssd1306_send_command(uint8_t cmd);
 extern void ssd1306_send_command_list(uint8_t *ssd, int number);
-extern void ssd1306_send_buffer(uint8_t ssd[], int buffer_length);
+extern bool ssd1306_send_buffer(uint8_t ssd[], int buffer_length);
+extern void ssd1306_command_builder_init(ssd1306_command_builder_t *builder, i2c_inst_t *i2c, uint8_t address);
+extern void ssd1306_command_builder_add(ssd1306_command_builder_t *builder, uint8_t command);
+extern void ssd1306_command_builder_add_list(ssd1306_command_builder_t *builder, const uint8_t *commands, int number);
+extern void ssd1306_command_builder_add_data(ssd1306_command_builder_t *builder, const uint8_t *data, int length);
+extern void ssd1306_command_builder_flush(ssd1306_command_builder_t *builder);
 extern void ssd1306_init();
 extern void ssd1306_scroll(bool set);
 extern void render_on_display(uint8_t *ssd, struct render_area *area);
+extern void ssd1306_clear_dirty(ssd1306_dirty_t *dirty);
+extern void ssd1306_mark_dirty(ssd1306_dirty_t *dirty, int x_0, int y_0, int x_1, int y_1);
+extern void render_dirty_on_display(uint8_t *ssd, ssd1306_dirty_t *dirty);
+extern void ssd1306_clear(uint8_t *ssd);
+extern void ssd1306_framebuffer_init(ssd1306_framebuffer_t *fb);
+extern void ssd1306_framebuffer_clear(ssd1306_framebuffer_t *fb);
+extern void render_framebuffer_on_display(ssd1306_framebuffer_t *fb, struct render_area *area);
+extern void render_framebuffer_dirty_on_display(ssd1306_framebuffer_t *fb);
+extern bool ssd1306_take_dirty_area(ssd1306_dirty_t *dirty, int page, struct render_area *area);
+extern void ssd1306_mark_area_clean(ssd1306_dirty_t *dirty, struct render_area *area);
+extern void ssd1306_async_init(const ssd1306_transport_t *transport);
+extern bool render_framebuffer_on_display_async(ssd1306_framebuffer_t *fb, struct render_area *area, ssd1306_async_callback_t callback, void *user_data);
+extern bool render_framebuffer_dirty_on_display_async(ssd1306_framebuffer_t *fb, ssd1306_async_callback_t callback, void *user_data);
+extern bool render_framebuffer_areas_on_display_async(ssd1306_framebuffer_t *fb, struct render_area *areas, int count, ssd1306_async_callback_t callback, void *user_data);
+extern bool ssd1306_async_busy();
+extern void ssd1306_async_wait();
+extern void ssd1306_async_transfer_complete();
 extern void ssd1306_set_pixel(uint8_t *ssd, int x, int y, bool set);
 extern void ssd1306_draw_line(uint8_t *ssd, int x_0, int y_0, int x_1, int y_1, bool set);
+extern void ssd1306_draw_hline(uint8_t *ssd, int x, int y, int width, bool set);
+extern void ssd1306_draw_vline(uint8_t *ssd, int x, int y, int height, bool set);
 extern void ssd1306_draw_char(uint8_t *ssd, int16_t x, int16_t y, uint8_t character);
 extern void ssd1306_draw_string(uint8_t *ssd, int16_t x, int16_t y, char *string);
+extern void ssd1306_draw_glyph(uint8_t *ssd, int x, int y, const uint8_t *glyph, int width, int height, ssd1306_draw_mode_t mode);
+extern void ssd1306_draw_char_mode(uint8_t *ssd, int16_t x, int16_t y, uint8_t character, ssd1306_draw_mode_t mode);
+extern void ssd1306_draw_string_mode(uint8_t *ssd, int16_t x, int16_t y, const char *string, ssd1306_draw_mode_t mode);
+extern const ssd1306_font_t ssd1306_font_8x8;
+extern const ssd1306_font_t ssd1306_font_proportional;
+extern const ssd1306_font_t ssd1306_font_5x7;
+extern const ssd1306_font_t ssd1306_font_12x16;
+extern const ssd1306_font_t ssd1306_font_16x24;
+extern int ssd1306_draw_char_font(uint8_t *ssd, int16_t x, int16_t y, uint8_t character, const ssd1306_font_t *font, ssd1306_draw_mode_t mode);
+extern int ssd1306_draw_string_font(uint8_t *ssd, int16_t x, int16_t y, const char *string, const ssd1306_font_t *font, ssd1306_draw_mode_t mode);
+extern int ssd1306_measure_string(const char *string, const ssd1306_font_t *font);
+extern int ssd1306_draw_string_font_n(uint8_t *ssd, int16_t x, int16_t y, const char *string, size_t length, const ssd1306_font_t *font, ssd1306_draw_mode_t mode);
+extern int ssd1306_measure_string_n(const char *string, size_t length, const ssd1306_font_t *font);
+extern size_t ssd1306_fit_string_n(const char *string, size_t length, const ssd1306_font_t *font, int max_width);
 extern void ssd1306_command(ssd1306_t *ssd, uint8_t command);
 extern void ssd1306_config(ssd1306_t *ssd);
 extern void ssd1306_init_bm(ssd1306_t *ssd, uint8_t width, uint8_t height, bool external_vcc, uint8_t address, i2c_inst_t *i2c);
 extern void ssd1306_send_data(ssd1306_t *ssd);
-extern void ssd1306_draw_bitmap(ssd1306_t *ssd, const uint8_t *bitmap);
\ No newline at end of file
+extern void ssd1306_draw_bitmap(ssd1306_t *ssd, const uint8_t *bitmap);
+extern void ssd1306_blit_bitmap(ssd1306_t *ssd, const uint8_t *bitmap, int x, int y, int width, int height);
+extern void ssd1306_draw_bitmap_partial(ssd1306_t *ssd, const uint8_t *bitmap, int x, int y, int width, int height);
+extern void ssd1306_double_buffer_init(ssd1306_double_buffer_t *db);
+extern int ssd1306_double_buffer_diff(ssd1306_double_buffer_t *db, struct render_area *areas);
+extern void ssd1306_present(ssd1306_double_buffer_t *db);
+extern bool ssd1306_present_async(ssd1306_double_buffer_t *db, ssd1306_async_callback_t callback, void *user_data);
+extern void ssd1306_latency_record(ssd1306_latency_t *latency, uint32_t start_us);
+extern void ssd1306_latency_read(const ssd1306_latency_t *latency, ssd1306_latency_t *snapshot);
+extern void ssd1306_pipeline_init();
+extern uint8_t *ssd1306_pipeline_begin_frame();
+extern bool ssd1306_pipeline_submit(uint32_t start_us);
+extern ssd1306_latency_t *ssd1306_pipeline_latency();
+extern void ssd1306_draw_string_n(uint8_t *ssd, int16_t x, int16_t y, const char *string, size_t length);
+extern void ssd1306_text_lines_init(ssd1306_text_lines_t *lines, const char *text, const ssd1306_font_t *font, int width);
+extern bool ssd1306_text_lines_next(ssd1306_text_lines_t *lines, const char **line, size_t *length);
+extern void ssd1306_rle_decode(const uint8_t *src, uint8_t *dst, int length);
+extern void ssd1306_layout_init(ssd1306_layout_t *layout, const ssd1306_font_t *font, int x, int y, int width, int height, ssd1306_align_t align, bool wrap);
+extern bool ssd1306_layout_set_text(ssd1306_layout_t *layout, const char *text);
+extern bool ssd1306_layout_set_line(ssd1306_layout_t *layout, int index, const char *text);
+extern void ssd1306_layout_draw(uint8_t *ssd, const ssd1306_layout_t *layout, ssd1306_draw_mode_t mode);
+extern void ssd1306_layout_draw_line(uint8_t *ssd, const ssd1306_layout_t *layout, int index);
+extern int ssd1306_format_fixed(char *out, int32_t value, int decimals);
+extern void ssd1306_number_field_init(ssd1306_number_field_t *field, const ssd1306_font_t *font, int x, int y, int cells, int decimals);
+extern void ssd1306_number_field_invalidate(ssd1306_number_field_t *field);
+extern int ssd1306_number_field_width(const ssd1306_number_field_t *field);
+extern int ssd1306_number_field_set(uint8_t *ssd, ssd1306_number_field_t *field, int32_t value);
+extern void ssd1306_fill_rect(uint8_t *ssd, int x, int y, int width, int height, bool set);
+extern void ssd1306_clear_rect(uint8_t *ssd, int x, int y, int width, int height);
+extern void ssd1306_invert_rect(uint8_t *ssd, int x, int y, int width, int height);
+extern void ssd1306_blit(uint8_t *ssd, int x, int y, const uint8_t *src, int src_width, int src_x, int src_y, int width, int height, ssd1306_draw_mode_t mode);
+extern void ssd1306_draw_rect(uint8_t *ssd, int x, int y, int width, int height, bool set);
+extern void ssd1306_draw_round_rect(uint8_t *ssd, int x, int y, int width, int height, int radius, bool set);
+extern void ssd1306_fill_round_rect(uint8_t *ssd, int x, int y, int width, int height, int radius, bool set);
+extern void ssd1306_draw_circle(uint8_t *ssd, int x_c, int y_c, int r, bool set);
+extern void ssd1306_fill_circle(uint8_t *ssd, int x_c, int y_c, int r, bool set);
+extern void ssd1306_draw_ellipse(uint8_t *ssd, int x_c, int y_c, int r_x, int r_y, bool set);
+extern void ssd1306_fill_ellipse(uint8_t *ssd, int x_c, int y_c, int r_x, int r_y, bool set);
+extern void ssd1306_draw_triangle(uint8_t *ssd, int x_0, int y_0, int x_1, int y_1, int x_2, int y_2, bool set);
+extern void ssd1306_fill_triangle(uint8_t *ssd, int x_0, int y_0, int x_1, int y_1, int x_2, int y_2, bool set);
+extern void ssd1306_ctx_init(ssd1306_context_t *ctx, uint8_t *ssd);
+extern void ssd1306_ctx_init_framebuffer(ssd1306_context_t *ctx, ssd1306_framebuffer_t *fb);
+extern bool ssd1306_ctx_push_clip(ssd1306_context_t *ctx, int x, int y, int width, int height);
+extern void ssd1306_ctx_pop_clip(ssd1306_context_t *ctx);
+extern void ssd1306_ctx_set_pixel(ssd1306_context_t *ctx, int x, int y, bool set);
+extern void ssd1306_ctx_fill_rect(ssd1306_context_t *ctx, int x, int y, int width, int height, bool set);
+extern void ssd1306_ctx_clear_rect(ssd1306_context_t *ctx, int x, int y, int width, int height);
+extern void ssd1306_ctx_invert_rect(ssd1306_context_t *ctx, int x, int y, int width, int height);
+extern void ssd1306_ctx_draw_hline(ssd1306_context_t *ctx, int x, int y, int width, bool set);
+extern void ssd1306_ctx_draw_vline(ssd1306_context_t *ctx, int x, int y, int height, bool set);
+extern void ssd1306_ctx_draw_line(ssd1306_context_t *ctx, int x_0, int y_0, int x_1, int y_1, bool set);
+extern void ssd1306_ctx_blit(ssd1306_context_t *ctx, int x, int y, const uint8_t *src, int src_width, int src_x, int src_y, int width, int height, ssd1306_draw_mode_t mode);
+extern void ssd1306_ctx_draw_glyph(ssd1306_context_t *ctx, int x, int y, const uint8_t *glyph, int width, int height, ssd1306_draw_mode_t mode);
+extern int ssd1306_ctx_draw_char_font(ssd1306_context_t *ctx, int x, int y, uint8_t character, const ssd1306_font_t *font, ssd1306_draw_mode_t mode);
+extern int ssd1306_ctx_draw_string_font(ssd1306_context_t *ctx, int x, int y, const char *string, const ssd1306_font_t *font, ssd1306_draw_mode_t mode);
+extern int ssd1306_ctx_draw_string_font_n(ssd1306_context_t *ctx, int x, int y, const char *string, size_t length, const ssd1306_font_t *font, ssd1306_draw_mode_t mode);
+extern void ssd1306_ctx_draw_rect(ssd1306_context_t *ctx, int x, int y, int width, int height, bool set);
+extern void ssd1306_ctx_draw_round_rect(ssd1306_context_t *ctx, int x, int y, int width, int height, int radius, bool set);
+extern void ssd1306_ctx_fill_round_rect(ssd1306_context_t *ctx, int x, int y, int width, int height, int radius, bool set);
+extern void ssd1306_ctx_draw_circle(ssd1306_context_t *ctx, int x_c, int y_c, int r, bool set);
+extern void ssd1306_ctx_fill_circle(ssd1306_context_t *ctx, int x_c, int y_c, int r, bool set);
+extern void ssd1306_ctx_draw_ellipse(ssd1306_context_t *ctx, int x_c, int y_c, int r_x, int r_y, bool set);
+extern void ssd1306_ctx_fill_ellipse(ssd1306_context_t *ctx, int x_c, int y_c, int r_x, int r_y, bool set);
+extern void ssd1306_ctx_draw_triangle(ssd1306_context_t *ctx, int x_0, int y_0, int x_1, int y_1, int x_2, int y_2, bool set);
+extern void ssd1306_ctx_fill_triangle(ssd1306_context_t *ctx, int x_0, int y_0, int x_1, int y_1, int x_2, int y_2, bool set);
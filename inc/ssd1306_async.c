@@ -0,0 +1,268 @@
+#include <string.h>
+#include "pico/stdlib.h"
+#include "hardware/i2c.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "ssd1306_i2c.h"
+#include "ssd1306.h"
+
+// Pior caso: uma transação de comandos (7 palavras) e uma de dados (1 + 128 palavras) por página
+#define ssd1306_async_max_words (ssd1306_n_pages * (7 + 1 + ssd1306_width))
+
+// Palavras do quadro em envio. Os pixels são copiados para cá ao iniciar o envio,
+// então o framebuffer pode ser redesenhado enquanto a transferência acontece.
+static uint16_t words[ssd1306_async_max_words];
+static size_t word_count;
+
+static const ssd1306_transport_t *transport = NULL;
+static volatile bool busy = false;
+static ssd1306_async_callback_t done_callback = NULL;
+static void *done_user_data = NULL;
+
+// Adiciona uma transação I2C (byte de controle + bytes) à lista de palavras, com STOP no último byte
+static void ssd1306_async_push(uint8_t control, const uint8_t *bytes, int length) {
+    words[word_count++] = control;
+    for (int i = 0; i < length; i++) {
+        words[word_count++] = bytes[i];
+    }
+    words[word_count - 1] |= I2C_IC_DATA_CMD_STOP_BITS;
+}
+
+// Adiciona a janela de endereços e os pixels de uma área contígua do framebuffer
+static void ssd1306_async_push_area(struct render_area *area, const uint8_t *data) {
+    // Co = 0: todos os comandos da janela numa única transação
+    uint8_t commands[] = {
+        ssd1306_set_column_address, area->start_column, area->end_column,
+        ssd1306_set_page_address, area->start_page, area->end_page
+    };
+
+    ssd1306_async_push(0x00, commands, count_of(commands));
+    ssd1306_async_push(0x40, data, area->buffer_length);
+}
+
+// Entrega as palavras montadas ao transporte (ou conclui na hora, se não há nada a enviar)
+static bool ssd1306_async_start(ssd1306_async_callback_t callback, void *user_data) {
+    done_callback = callback;
+    done_user_data = user_data;
+
+    if (word_count == 0) {
+        ssd1306_async_transfer_complete();
+        return true;
+    }
+
+    busy = true;
+    transport->start(words, word_count);
+    return true;
+}
+
+/* ======================================================================
+ * Transporte padrão: DMA do RP2040 alimentando o FIFO de transmissão do I2C (DREQ)
+ * ====================================================================== */
+
+// Intervalo entre as consultas ao barramento depois do fim do DMA (~1 byte a 400 kHz)
+#define ssd1306_dma_drain_poll_us 25
+
+static int dma_channel = -1;
+
+// FIFO de transmissão vazio e controlador sem transação em andamento (STOP já enviado)
+static bool ssd1306_dma_bus_idle(void) {
+    i2c_hw_t *hw = i2c_get_hw(i2c1);
+    return (hw->status & I2C_IC_STATUS_TFE_BITS) && !(hw->status & I2C_IC_STATUS_MST_ACTIVITY_BITS);
+}
+
+// Aguarda o FIFO esvaziar e o controlador terminar a última transação
+static void ssd1306_dma_wait_idle(void) {
+    while (!ssd1306_dma_bus_idle()) {
+        tight_loop_contents();
+    }
+}
+
+static int64_t ssd1306_dma_drain_poll(alarm_id_t id, void *user_data) {
+    if (!ssd1306_dma_bus_idle()) {
+        return ssd1306_dma_drain_poll_us;
+    }
+    ssd1306_async_transfer_complete();
+    return 0;
+}
+
+// O DMA termina quando a última palavra entra no FIFO do I2C, com até 16 bytes ainda por sair
+// (~360 us a 400 kHz). O envio só é concluído (e o callback chamado) com o barramento ocioso,
+// o mesmo ponto em que i2c_write_blocking retorna no envio bloqueante (ex.: o do pipeline);
+// enquanto isso um alarme consulta o controlador, sem prender a interrupção.
+static void ssd1306_dma_irq_handler(void) {
+    if (dma_channel >= 0 && dma_channel_get_irq0_status(dma_channel)) {
+        dma_channel_acknowledge_irq0(dma_channel);
+
+        if (!ssd1306_dma_bus_idle() &&
+            add_alarm_in_us(ssd1306_dma_drain_poll_us, ssd1306_dma_drain_poll, NULL, true) >= 0) {
+            return;
+        }
+
+        // Barramento já ocioso, ou sem alarme livre: espera aqui mesmo
+        ssd1306_dma_wait_idle();
+        ssd1306_async_transfer_complete();
+    }
+}
+
+static void ssd1306_dma_start(const uint16_t *data, size_t count) {
+    dma_channel_transfer_from_buffer_now(dma_channel, data, count);
+}
+
+static void ssd1306_dma_init(void) {
+    i2c_hw_t *hw = i2c_get_hw(i2c1);
+
+    // O endereço de destino só pode ser alterado com o controlador desabilitado
+    hw->enable = 0;
+    hw->tar = ssd1306_i2c_address;
+    hw->enable = 1;
+
+    dma_channel = dma_claim_unused_channel(true);
+
+    // Palavras de 16 bits (byte + bits de controle) para IC_DATA_CMD, no ritmo do DREQ de transmissão
+    dma_channel_config config = dma_channel_get_default_config(dma_channel);
+    channel_config_set_transfer_data_size(&config, DMA_SIZE_16);
+    channel_config_set_read_increment(&config, true);
+    channel_config_set_write_increment(&config, false);
+    channel_config_set_dreq(&config, i2c_get_dreq(i2c1, true));
+    dma_channel_configure(dma_channel, &config, &hw->data_cmd, words, 0, false);
+
+    dma_channel_set_irq0_enabled(dma_channel, true);
+    irq_add_shared_handler(DMA_IRQ_0, ssd1306_dma_irq_handler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    irq_set_enabled(DMA_IRQ_0, true);
+}
+
+static const ssd1306_transport_t dma_transport = {
+    .start = ssd1306_dma_start,
+    .wait_idle = ssd1306_dma_wait_idle,
+};
+
+/* ====================================================================== */
+
+// Inicializa o envio assíncrono; com transport == NULL usa o DMA do RP2040
+void ssd1306_async_init(const ssd1306_transport_t *custom_transport) {
+    ssd1306_async_wait();
+
+    if (custom_transport) {
+        transport = custom_transport;
+    }
+    else {
+        if (dma_channel < 0) {
+            ssd1306_dma_init();
+        }
+        transport = &dma_transport;
+    }
+}
+
+// Adiciona uma área (janela dentro do quadro inteiro) do framebuffer, uma transação por página se for parcial
+static void ssd1306_async_push_framebuffer_area(ssd1306_framebuffer_t *fb, struct render_area *area) {
+    if (area->start_column == 0 && area->end_column == ssd1306_width - 1) {
+        ssd1306_async_push_area(area, fb->data + area->start_page * ssd1306_width);
+    }
+    else {
+        for (int page = area->start_page; page <= area->end_page; page++) {
+            struct render_area row = {
+                .start_column = area->start_column,
+                .end_column = area->end_column,
+                .start_page = page,
+                .end_page = page
+            };
+            calculate_render_area_buffer_length(&row);
+            ssd1306_async_push_area(&row, fb->data + page * ssd1306_width + row.start_column);
+        }
+    }
+}
+
+// Inicia o envio de uma área do framebuffer e retorna imediatamente
+// Retorna false (sem enviar nada) se ainda houver um envio em andamento
+bool render_framebuffer_on_display_async(ssd1306_framebuffer_t *fb, struct render_area *area, ssd1306_async_callback_t callback, void *user_data) {
+    if (busy || !transport) {
+        return false;
+    }
+
+    word_count = 0;
+    ssd1306_async_push_framebuffer_area(fb, area);
+    ssd1306_mark_area_clean(&fb->dirty, area);
+
+    return ssd1306_async_start(callback, user_data);
+}
+
+// Inicia o envio de várias áreas do framebuffer (ex.: as diferenças de ssd1306_double_buffer_diff)
+// Se as áreas não couberem na lista de palavras, envia o quadro inteiro
+bool render_framebuffer_areas_on_display_async(ssd1306_framebuffer_t *fb, struct render_area *areas, int count, ssd1306_async_callback_t callback, void *user_data) {
+    if (busy || !transport) {
+        return false;
+    }
+
+    size_t needed = 0;
+    for (int i = 0; i < count; i++) {
+        int rows = areas[i].start_column == 0 && areas[i].end_column == ssd1306_width - 1 ? 1 : areas[i].end_page - areas[i].start_page + 1;
+        needed += rows * (7 + 1) + areas[i].buffer_length;
+    }
+
+    word_count = 0;
+    if (needed > ssd1306_async_max_words) {
+        struct render_area frame = {
+            .start_column = 0,
+            .end_column = ssd1306_width - 1,
+            .start_page = 0,
+            .end_page = ssd1306_n_pages - 1
+        };
+        calculate_render_area_buffer_length(&frame);
+        ssd1306_async_push_framebuffer_area(fb, &frame);
+    }
+    else {
+        for (int i = 0; i < count; i++) {
+            ssd1306_async_push_framebuffer_area(fb, &areas[i]);
+        }
+    }
+
+    return ssd1306_async_start(callback, user_data);
+}
+
+// Inicia o envio somente das faixas alteradas de cada página e retorna imediatamente
+// Retorna false (mantendo as faixas sujas) se ainda houver um envio em andamento
+bool render_framebuffer_dirty_on_display_async(ssd1306_framebuffer_t *fb, ssd1306_async_callback_t callback, void *user_data) {
+    if (busy || !transport) {
+        return false;
+    }
+
+    word_count = 0;
+    for (int page = 0; page < ssd1306_n_pages; page++) {
+        struct render_area area;
+        if (ssd1306_take_dirty_area(&fb->dirty, page, &area)) {
+            ssd1306_async_push_area(&area, fb->data + page * ssd1306_width + area.start_column);
+        }
+    }
+
+    return ssd1306_async_start(callback, user_data);
+}
+
+// Indica se há um envio assíncrono em andamento
+bool ssd1306_async_busy() {
+    return busy;
+}
+
+// Aguarda o fim do envio assíncrono em andamento (e o esvaziamento do barramento)
+void ssd1306_async_wait() {
+    if (!transport) {
+        return;
+    }
+
+    while (busy) {
+        tight_loop_contents();
+    }
+    if (transport->wait_idle) {
+        transport->wait_idle();
+    }
+}
+
+// Chamada pelo transporte quando todas as palavras foram entregues
+void ssd1306_async_transfer_complete() {
+    busy = false;
+
+    if (done_callback) {
+        ssd1306_async_callback_t callback = done_callback;
+        done_callback = NULL;
+        callback(done_user_data);
+    }
+}
@@ -0,0 +1,93 @@
+#include <string.h>
+#include "pico/stdlib.h"
+#include "ssd1306_i2c.h"
+#include "ssd1306.h"
+
+// Prepara o par de framebuffers zerados (o display deve começar apagado, ex.: após enviar back inteiro)
+void ssd1306_double_buffer_init(ssd1306_double_buffer_t *db) {
+    ssd1306_framebuffer_init(&db->back);
+    memset(db->front, 0, ssd1306_buffer_length);
+}
+
+// Compara back com front página a página e preenche "areas" com os trechos que diferem
+// Trechos próximos (até ssd1306_diff_merge_gap bytes iguais entre eles) são unidos numa só área
+// Retorna o número de áreas (0 se nada mudou); "areas" deve ter ssd1306_max_diff_areas posições
+int ssd1306_double_buffer_diff(ssd1306_double_buffer_t *db, struct render_area *areas) {
+    int count = 0;
+
+    for (int page = 0; page < ssd1306_n_pages; page++) {
+        const uint8_t *back = db->back.data + page * ssd1306_width;
+        const uint8_t *front = db->front + page * ssd1306_width;
+        int column = 0;
+
+        while (column < ssd1306_width) {
+            // Início do próximo trecho alterado
+            while (column < ssd1306_width && back[column] == front[column]) {
+                column++;
+            }
+            if (column == ssd1306_width) {
+                break;
+            }
+
+            int start = column;
+            int end = column;
+
+            // Estende o trecho enquanto o próximo byte alterado estiver a até ssd1306_diff_merge_gap bytes
+            for (column++; column < ssd1306_width && column - end <= ssd1306_diff_merge_gap + 1; column++) {
+                if (back[column] != front[column]) {
+                    end = column;
+                }
+            }
+            column = end + 1;
+
+            struct render_area *area = &areas[count++];
+            area->start_column = start;
+            area->end_column = end;
+            area->start_page = page;
+            area->end_page = page;
+            calculate_render_area_buffer_length(area);
+        }
+    }
+
+    return count;
+}
+
+// Iguala front a back nos trechos enviados
+static void ssd1306_double_buffer_sync(ssd1306_double_buffer_t *db, struct render_area *areas, int count) {
+    for (int i = 0; i < count; i++) {
+        int offset = areas[i].start_page * ssd1306_width + areas[i].start_column;
+        memcpy(db->front + offset, db->back.data + offset, areas[i].buffer_length);
+    }
+
+    // O display passa a refletir back por inteiro: não há faixas sujas pendentes
+    ssd1306_clear_dirty(&db->back.dirty);
+}
+
+// Envia ao display somente os bytes de back que diferem de front (bloqueante)
+void ssd1306_present(ssd1306_double_buffer_t *db) {
+    static struct render_area areas[ssd1306_max_diff_areas];
+    int count = ssd1306_double_buffer_diff(db, areas);
+
+    for (int i = 0; i < count; i++) {
+        render_framebuffer_on_display(&db->back, &areas[i]);
+    }
+    ssd1306_double_buffer_sync(db, areas, count);
+}
+
+// Igual a ssd1306_present, mas inicia o envio e retorna imediatamente
+// Retorna false (sem enviar nada) se ainda houver um envio assíncrono em andamento
+bool ssd1306_present_async(ssd1306_double_buffer_t *db, ssd1306_async_callback_t callback, void *user_data) {
+    static struct render_area areas[ssd1306_max_diff_areas];
+
+    if (ssd1306_async_busy()) {
+        return false;
+    }
+
+    int count = ssd1306_double_buffer_diff(db, areas);
+    if (!render_framebuffer_areas_on_display_async(&db->back, areas, count, callback, user_data)) {
+        return false;
+    }
+    ssd1306_double_buffer_sync(db, areas, count);
+
+    return true;
+}
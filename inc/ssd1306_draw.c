@@ -0,0 +1,996 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include "pico/stdlib.h"
+#include "hardware/i2c.h"
+#include "ssd1306_font.h"
+#include "ssd1306_font_prop.h"
+#include "ssd1306_i2c.h"
+#include "ssd1306.h"
+
+// Desenho no framebuffer (pixels, linhas, glifos, texto) e controle das faixas alteradas.
+// Não acessa o hardware: o envio ao display fica em ssd1306_i2c.c, e este arquivo também
+// compila no computador (ver tools/page_baker).
+
+// Faixas sujas: cada primitiva recebe o ssd1306_dirty_t do buffer em que desenha (o do contexto ou de
+// ssd1306_framebuffer_t; NULL nas funções que recebem só os pixels). Assim, desenhar num quadro auxiliar
+// (cache de páginas, quadros do pipeline) não suja o que vai ao display, e o laço interno não procura nada.
+
+// Marca a coluna de uma página como alterada
+static inline void ssd1306_dirty_mark(ssd1306_dirty_t *dirty, int page, int column) {
+    if (!dirty) {
+        return;
+    }
+    if (!dirty->pages[page].is_dirty) {
+        dirty->pages[page].is_dirty = true;
+        dirty->pages[page].min_column = column;
+        dirty->pages[page].max_column = column;
+    }
+    else if (column < dirty->pages[page].min_column) {
+        dirty->pages[page].min_column = column;
+    }
+    else if (column > dirty->pages[page].max_column) {
+        dirty->pages[page].max_column = column;
+    }
+}
+
+// Marca todas as páginas como limpas (sem alterações pendentes)
+void ssd1306_clear_dirty(ssd1306_dirty_t *dirty) {
+    if (dirty) {
+        for (int page = 0; page < ssd1306_n_pages; page++) {
+            dirty->pages[page].is_dirty = false;
+        }
+    }
+}
+
+// Marca um retângulo (em pixels) como alterado, recortando o que estiver fora da tela
+void ssd1306_mark_dirty(ssd1306_dirty_t *dirty, int x_0, int y_0, int x_1, int y_1) {
+    if (x_0 < 0) x_0 = 0;
+    if (y_0 < 0) y_0 = 0;
+    if (x_1 > ssd1306_width - 1) x_1 = ssd1306_width - 1;
+    if (y_1 > ssd1306_height - 1) y_1 = ssd1306_height - 1;
+    if (x_0 > x_1 || y_0 > y_1) {
+        return;
+    }
+
+    for (int page = y_0 / 8; page <= y_1 / 8; page++) {
+        ssd1306_dirty_mark(dirty, page, x_0);
+        ssd1306_dirty_mark(dirty, page, x_1);
+    }
+}
+
+// Retira a faixa suja de uma página como área de renderização (a página passa a estar limpa)
+bool ssd1306_take_dirty_area(ssd1306_dirty_t *dirty, int page, struct render_area *area) {
+    if (!dirty || !dirty->pages[page].is_dirty) {
+        return false;
+    }
+
+    area->start_column = dirty->pages[page].min_column;
+    area->end_column = dirty->pages[page].max_column;
+    area->start_page = page;
+    area->end_page = page;
+    calculate_render_area_buffer_length(area);
+
+    dirty->pages[page].is_dirty = false;
+    return true;
+}
+
+// As faixas sujas totalmente cobertas pela área enviada passam a estar em dia com o display
+void ssd1306_mark_area_clean(ssd1306_dirty_t *dirty, struct render_area *area) {
+    if (!dirty) {
+        return;
+    }
+    for (int page = area->start_page; page <= area->end_page; page++) {
+        if (dirty->pages[page].min_column >= area->start_column && dirty->pages[page].max_column <= area->end_column) {
+            dirty->pages[page].is_dirty = false;
+        }
+    }
+}
+
+// Calcular quanto do buffer será destinado à área de renderização
+void calculate_render_area_buffer_length(struct render_area *area) {
+    area->buffer_length = (area->end_column - area->start_column + 1) * (area->end_page - area->start_page + 1);
+}
+
+// Limpa o framebuffer, marcando como alteradas apenas as colunas que tinham algum pixel aceso
+static void ssd1306_clear_tracked(uint8_t *ssd, ssd1306_dirty_t *dirty) {
+    for (int page = 0; page < ssd1306_n_pages; page++) {
+        uint8_t *row = ssd + page * ssd1306_width;
+        int first = 0;
+        int last = ssd1306_width - 1;
+
+        while (first <= last && row[first] == 0) {
+            first++;
+        }
+        while (last >= first && row[last] == 0) {
+            last--;
+        }
+        if (first > last) {
+            continue;
+        }
+
+        memset(row + first, 0, last - first + 1);
+        ssd1306_dirty_mark(dirty, page, first);
+        ssd1306_dirty_mark(dirty, page, last);
+    }
+}
+
+// Limpa um buffer sem faixas sujas (o envio seguinte precisa ser do quadro inteiro)
+void ssd1306_clear(uint8_t *ssd) {
+    ssd1306_clear_tracked(ssd, NULL);
+}
+
+// Limpa o framebuffer, acumulando em fb->dirty as colunas apagadas
+void ssd1306_framebuffer_clear(ssd1306_framebuffer_t *fb) {
+    ssd1306_clear_tracked(fb->data, &fb->dirty);
+}
+
+// Recorte da tela inteira, usado pelas funções que recebem só o framebuffer
+static const ssd1306_clip_t ssd1306_screen_clip = {0, 0, ssd1306_width - 1, ssd1306_height - 1};
+
+// Acende ou apaga um pixel sem conferir limites (quem chama já recortou)
+static inline void ssd1306_put_pixel(uint8_t *ssd, ssd1306_dirty_t *dirty, int x, int y, bool set) {
+    const int bytes_per_row = ssd1306_width;
+
+    int byte_idx = (y / 8) * bytes_per_row + x;
+    uint8_t byte = ssd[byte_idx];
+
+    if (set) {
+        byte |= 1 << (y % 8);
+    }
+    else {
+        byte &= ~(1 << (y % 8));
+    }
+
+    // Só marca a coluna como alterada se o byte realmente mudou
+    if (byte != ssd[byte_idx]) {
+        ssd[byte_idx] = byte;
+        ssd1306_dirty_mark(dirty, y / 8, x);
+    }
+}
+
+// Determina o pixel a ser aceso (no display) de acordo com a coordenada fornecida
+// Versão sem recorte: a coordenada precisa estar na tela (ver ssd1306_ctx_set_pixel)
+void ssd1306_set_pixel(uint8_t *ssd, int x, int y, bool set) {
+    assert(x >= 0 && x < ssd1306_width && y >= 0 && y < ssd1306_height);
+
+    ssd1306_put_pixel(ssd, NULL, x, y, set);
+}
+
+// Adquire o deslocamento do glifo de um caractere em font[] (de acordo com ssd1306_font.h)
+// Todos os glifos têm 8 bytes, então o deslocamento é direto; controles abaixo de 0x20 viram espaço
+static inline int ssd1306_get_font(uint8_t character)
+{
+  if (character < ssd1306_font_first_char) {
+    character = ' ';
+  }
+  return (character - ssd1306_font_first_char) * 8;
+}
+
+// Combina os bits de um glifo com um byte do framebuffer; mask indica os pixels cobertos pelo glifo
+static inline uint8_t ssd1306_combine(uint8_t dst, uint8_t bits, uint8_t mask, ssd1306_draw_mode_t mode) {
+    switch (mode) {
+    case ssd1306_draw_or:
+        return dst | bits;
+    case ssd1306_draw_and_not:
+        return dst & ~bits;
+    case ssd1306_draw_xor:
+        return dst ^ bits;
+    default:
+        return (dst & ~mask) | bits;
+    }
+}
+
+// Escreve um byte combinado no framebuffer, marcando a coluna se ele mudar
+static inline void ssd1306_blend_byte(uint8_t *ssd, ssd1306_dirty_t *dirty, int page, int x, uint8_t bits, uint8_t mask, ssd1306_draw_mode_t mode) {
+    uint8_t *dst = &ssd[page * ssd1306_width + x];
+    uint8_t value = ssd1306_combine(*dst, bits, mask, mode);
+
+    if (value != *dst) {
+        *dst = value;
+        ssd1306_dirty_mark(dirty, page, x);
+    }
+}
+
+// Copia width bytes para uma página a partir da coluna x, marcando como suja só a faixa que realmente mudou
+static inline void ssd1306_copy_row(uint8_t *ssd, ssd1306_dirty_t *dirty, int page, int x, const uint8_t *row, int width) {
+    uint8_t *dst = &ssd[page * ssd1306_width + x];
+    int first = 0, last = width - 1;
+
+    while (first < width && dst[first] == row[first]) {
+        first++;
+    }
+    if (first == width) {
+        return;
+    }
+    while (dst[last] == row[last]) {
+        last--;
+    }
+
+    memcpy(dst + first, row + first, last - first + 1);
+    ssd1306_dirty_mark(dirty, page, x + first);
+    ssd1306_dirty_mark(dirty, page, x + last);
+}
+
+// Bits de uma página cobertos pelas linhas y_0..y_1 do recorte (0 se a página estiver fora dele)
+static inline uint8_t ssd1306_clip_page_mask(const ssd1306_clip_t *clip, int page) {
+    if (page < 0 || page * 8 > clip->y_1 || page * 8 + 7 < clip->y_0) {
+        return 0;
+    }
+
+    uint8_t mask = 0xFF;
+    if (page == clip->y_0 / 8) {
+        mask &= (uint8_t)(0xFF << (clip->y_0 & 7));
+    }
+    if (page == clip->y_1 / 8) {
+        mask &= (uint8_t)(0xFF >> (7 - (clip->y_1 & 7)));
+    }
+    return mask;
+}
+
+// Desenha um glifo (width x height pixels) com o canto superior esquerdo em (x, y), em qualquer posição
+// O glifo é organizado como o framebuffer: (height + 7) / 8 linhas de página com width bytes verticais cada
+// Fora de alinhamento, cada coluna de 8 pixels é deslocada e dividida entre duas páginas (palavra de 16 bits)
+// A parte que ficar fora do recorte é descartada: colunas pelo intervalo do laço, linhas pela máscara da página
+static void ssd1306_draw_glyph_clipped(uint8_t *ssd, ssd1306_dirty_t *dirty, const ssd1306_clip_t *clip, int x, int y, const uint8_t *glyph, int width, int height, ssd1306_draw_mode_t mode) {
+    int src_pages = (height + 7) / 8;
+
+    // Caso comum (texto e leituras numéricas em linhas de página): glifo opaco, alinhado à página e inteiro no recorte;
+    // cada linha de página é copiada direto com memcpy, marcando como suja só a faixa que mudou
+    if (mode == ssd1306_draw_opaque && (y & 7) == 0 && (height & 7) == 0 &&
+        x >= clip->x_0 && x + width - 1 <= clip->x_1 && y >= clip->y_0 && y + height - 1 <= clip->y_1) {
+        for (int src_page = 0; src_page < src_pages; src_page++) {
+            ssd1306_copy_row(ssd, dirty, y / 8 + src_page, x, glyph + src_page * width, width);
+        }
+        return;
+    }
+
+    int first_column = x < clip->x_0 ? clip->x_0 - x : 0;
+    int last_column = x + width - 1 > clip->x_1 ? clip->x_1 - x + 1 : width;
+
+    for (int src_page = 0; src_page < src_pages; src_page++) {
+        const uint8_t *row = glyph + src_page * width;
+        int rows = height - src_page * 8;
+        uint8_t mask = rows >= 8 ? 0xFF : (uint8_t)((1u << rows) - 1);
+
+        // Página de destino (arredondada para baixo, mesmo com y negativo) e deslocamento dentro dela
+        int dst_y = y + src_page * 8;
+        int page = dst_y >= 0 ? dst_y / 8 : -((7 - dst_y) / 8);
+        int shift = dst_y - page * 8;
+
+        uint16_t clip_mask = (uint16_t)(ssd1306_clip_page_mask(clip, page) | (shift ? ssd1306_clip_page_mask(clip, page + 1) << 8 : 0));
+        bool low_visible = (clip_mask & 0xFF) != 0;
+        bool high_visible = (clip_mask >> 8) != 0;
+
+        for (int i = first_column; i < last_column; i++) {
+            uint16_t bits = (uint16_t)((row[i] & mask) << shift) & clip_mask;
+            uint16_t bits_mask = (uint16_t)(mask << shift) & clip_mask;
+
+            if (low_visible) {
+                ssd1306_blend_byte(ssd, dirty, page, x + i, (uint8_t)bits, (uint8_t)bits_mask, mode);
+            }
+            if (high_visible) {
+                ssd1306_blend_byte(ssd, dirty, page + 1, x + i, (uint8_t)(bits >> 8), (uint8_t)(bits_mask >> 8), mode);
+            }
+        }
+    }
+}
+
+// Desenha um glifo em qualquer posição da tela (ver ssd1306_draw_glyph_clipped); a parte fora da tela é recortada
+void ssd1306_draw_glyph(uint8_t *ssd, int x, int y, const uint8_t *glyph, int width, int height, ssd1306_draw_mode_t mode) {
+    ssd1306_draw_glyph_clipped(ssd, NULL, &ssd1306_screen_clip, x, y, glyph, width, height, mode);
+}
+
+// Palavra de 32 bits (4 colunas de uma página) que pode apelidar os bytes do framebuffer nas operações em bloco
+typedef uint32_t __attribute__((may_alias)) ssd1306_word_t;
+
+// ssd1306_combine para 4 bytes de uma vez, com os mesmos bits em todos eles
+static inline uint32_t ssd1306_combine_word(uint32_t dst, uint32_t mask, ssd1306_draw_mode_t mode) {
+    switch (mode) {
+    case ssd1306_draw_and_not:
+        return dst & ~mask;
+    case ssd1306_draw_xor:
+        return dst ^ mask;
+    default:
+        return dst | mask;
+    }
+}
+
+// Aplica mode com a máscara mask às colunas x..x+width-1 de uma página: byte a byte até o endereço ficar
+// alinhado, depois 4 colunas por palavra de 32 bits; marca como suja só a faixa (em palavras) que mudou
+static void ssd1306_fill_row(uint8_t *ssd, ssd1306_dirty_t *dirty, int page, int x, int width, uint8_t mask, ssd1306_draw_mode_t mode) {
+    uint8_t *row = ssd + page * ssd1306_width;
+    uint8_t *p = row + x;
+    uint8_t *end = p + width;
+    uint8_t *aligned_end = end - ((uintptr_t)end & 3);
+    uint32_t mask_word = mask * 0x01010101u;
+    int first = -1, last = -1;
+
+    for (; p < end; p++) {
+        if (((uintptr_t)p & 3) == 0 && p < aligned_end) {
+            ssd1306_word_t *word = (ssd1306_word_t *)p;
+            uint32_t value = ssd1306_combine_word(*word, mask_word, mode);
+
+            if (value != *word) {
+                *word = value;
+                first = first < 0 ? p - row : first;
+                last = p - row + 3;
+            }
+            p += 3;
+            continue;
+        }
+
+        uint8_t value = ssd1306_combine(*p, mask, mask, mode);
+        if (value != *p) {
+            *p = value;
+            first = first < 0 ? p - row : first;
+            last = p - row;
+        }
+    }
+
+    if (first >= 0) {
+        ssd1306_dirty_mark(dirty, page, first);
+        ssd1306_dirty_mark(dirty, page, last);
+    }
+}
+
+// Recorta um retângulo (ajustando também a origem de uma cópia, se houver); retorna false se nada sobrar
+static bool ssd1306_clip_rect(const ssd1306_clip_t *clip, int *x, int *y, int *width, int *height, int *src_x, int *src_y) {
+    if (*x < clip->x_0) {
+        *width -= clip->x_0 - *x;
+        *src_x += clip->x_0 - *x;
+        *x = clip->x_0;
+    }
+    if (*y < clip->y_0) {
+        *height -= clip->y_0 - *y;
+        *src_y += clip->y_0 - *y;
+        *y = clip->y_0;
+    }
+    if (*x + *width - 1 > clip->x_1) {
+        *width = clip->x_1 - *x + 1;
+    }
+    if (*y + *height - 1 > clip->y_1) {
+        *height = clip->y_1 - *y + 1;
+    }
+    return *width > 0 && *height > 0;
+}
+
+// Bits de uma página cobertos pelas linhas y..y+height-1
+static inline uint8_t ssd1306_page_mask(int page, int y, int height) {
+    uint8_t mask = 0xFF;
+
+    if (page == y / 8) {
+        mask &= (uint8_t)(0xFF << (y & 7));
+    }
+    if (page == (y + height - 1) / 8) {
+        mask &= (uint8_t)(0xFF >> (7 - ((y + height - 1) & 7)));
+    }
+    return mask;
+}
+
+// Aplica mode (or, and_not ou xor) a todos os pixels do retângulo, uma linha de página por vez
+static void ssd1306_rect_op(uint8_t *ssd, ssd1306_dirty_t *dirty, const ssd1306_clip_t *clip, int x, int y, int width, int height, ssd1306_draw_mode_t mode) {
+    int src_x = 0, src_y = 0;
+
+    if (!ssd1306_clip_rect(clip, &x, &y, &width, &height, &src_x, &src_y)) {
+        return;
+    }
+
+    for (int page = y / 8; page <= (y + height - 1) / 8; page++) {
+        ssd1306_fill_row(ssd, dirty, page, x, width, ssd1306_page_mask(page, y, height), mode);
+    }
+}
+
+// Acende (set) ou apaga todos os pixels de um retângulo (ex.: barra de progresso), recortando o que sair da tela
+void ssd1306_fill_rect(uint8_t *ssd, int x, int y, int width, int height, bool set) {
+    ssd1306_rect_op(ssd, NULL, &ssd1306_screen_clip, x, y, width, height, set ? ssd1306_draw_or : ssd1306_draw_and_not);
+}
+
+// Apaga todos os pixels de um retângulo
+void ssd1306_clear_rect(uint8_t *ssd, int x, int y, int width, int height) {
+    ssd1306_rect_op(ssd, NULL, &ssd1306_screen_clip, x, y, width, height, ssd1306_draw_and_not);
+}
+
+// Inverte todos os pixels de um retângulo (ex.: barra de seleção sobre um item de menu)
+void ssd1306_invert_rect(uint8_t *ssd, int x, int y, int width, int height) {
+    ssd1306_rect_op(ssd, NULL, &ssd1306_screen_clip, x, y, width, height, ssd1306_draw_xor);
+}
+
+// Copia um retângulo de width x height pixels, que começa em (src_x, src_y) de src, para (x, y) de ssd
+// src está no formato do framebuffer, com src_width bytes por linha de página (ssd1306_width para outro
+// framebuffer); os dois y podem ter qualquer deslocamento de bit. O destino é recortado, a origem
+// precisa conter o retângulo inteiro e os dois buffers não podem ser o mesmo
+static void ssd1306_blit_clipped(uint8_t *ssd, ssd1306_dirty_t *dirty, const ssd1306_clip_t *clip, int x, int y, const uint8_t *src, int src_width, int src_x, int src_y, int width, int height, ssd1306_draw_mode_t mode) {
+    if (!ssd1306_clip_rect(clip, &x, &y, &width, &height, &src_x, &src_y)) {
+        return;
+    }
+
+    int src_first_page = src_y / 8;
+    int src_last_page = (src_y + height - 1) / 8;
+
+    for (int page = y / 8; page <= (y + height - 1) / 8; page++) {
+        uint8_t mask = ssd1306_page_mask(page, y, height);
+
+        // Linha da origem que cai no topo desta página (pode ser anterior ao retângulo na primeira página)
+        int top = page * 8 - y + src_y;
+        int src_page = top >= 0 ? top / 8 : -((7 - top) / 8);
+        int shift = top - src_page * 8;
+        const uint8_t *low = src_page >= src_first_page ? src + src_page * src_width + src_x : NULL;
+        const uint8_t *high = shift && src_page + 1 <= src_last_page ? src + (src_page + 1) * src_width + src_x : NULL;
+
+        // Origem e destino alinhados na mesma linha de página: cópia direta, como no glifo alinhado
+        if (mode == ssd1306_draw_opaque && shift == 0 && mask == 0xFF) {
+            ssd1306_copy_row(ssd, dirty, page, x, low, width);
+            continue;
+        }
+
+        for (int i = 0; i < width; i++) {
+            uint8_t bits = (uint8_t)((low ? low[i] >> shift : 0) | (high ? high[i] << (8 - shift) : 0));
+            ssd1306_blend_byte(ssd, dirty, page, x + i, bits & mask, mask, mode);
+        }
+    }
+}
+
+// Copia um retângulo de outro buffer para a tela (ver ssd1306_blit_clipped)
+void ssd1306_blit(uint8_t *ssd, int x, int y, const uint8_t *src, int src_width, int src_x, int src_y, int width, int height, ssd1306_draw_mode_t mode) {
+    ssd1306_blit_clipped(ssd, NULL, &ssd1306_screen_clip, x, y, src, src_width, src_x, src_y, width, height, mode);
+}
+
+// Linha horizontal de width pixels a partir de (x, y): um único byte de máscara aplicado ao longo da linha de página
+void ssd1306_draw_hline(uint8_t *ssd, int x, int y, int width, bool set) {
+    ssd1306_fill_rect(ssd, x, y, width, 1, set);
+}
+
+// Linha vertical de height pixels a partir de (x, y): um byte inteiro (ou parcial, nas pontas) por página
+void ssd1306_draw_vline(uint8_t *ssd, int x, int y, int height, bool set) {
+    ssd1306_fill_rect(ssd, x, y, 1, height, set);
+}
+
+// Códigos de região de Cohen–Sutherland: em que lado(s) do recorte o ponto está
+enum {
+    ssd1306_outcode_left = 1,
+    ssd1306_outcode_right = 2,
+    ssd1306_outcode_top = 4,
+    ssd1306_outcode_bottom = 8,
+};
+
+static inline int ssd1306_outcode(const ssd1306_clip_t *clip, int x, int y) {
+    int code = 0;
+
+    if (x < clip->x_0) code |= ssd1306_outcode_left;
+    else if (x > clip->x_1) code |= ssd1306_outcode_right;
+    if (y < clip->y_0) code |= ssd1306_outcode_top;
+    else if (y > clip->y_1) code |= ssd1306_outcode_bottom;
+    return code;
+}
+
+// Divisão arredondada para cima (b > 0), também para a negativo
+static inline int64_t ssd1306_div_ceil(int64_t a, int64_t b) {
+    return a >= 0 ? (a + b - 1) / b : -((-a) / b);
+}
+
+// Intervalo de n em que start + step * n (step = 1 ou -1) fica dentro de [min, max]
+static inline void ssd1306_axis_range(int start, int step, int min, int max, int64_t *low, int64_t *high) {
+    *low = step > 0 ? min - start : start - max;
+    *high = step > 0 ? max - start : start - min;
+}
+
+// Bit da linha seguinte na mesma página, para baixo (step = 1) ou para cima (step = -1); 0 ao sair da página
+static inline uint8_t ssd1306_next_bit(uint8_t bit, int step) {
+    return (uint8_t)(step > 0 ? bit << 1 : bit >> 1);
+}
+
+// Algoritmo de Bresenham; pontas fora do recorte são permitidas
+// Linhas horizontais e verticais vão para os caminhos rápidos. Nas demais, o passo i do eixo maior (de 0 a major)
+// tem avanço floor((2 * minor * i + major) / (2 * major)) no eixo menor, então o trecho visível é recortado
+// direto nos passos, com os mesmos pixels da linha inteira (recortar as pontas e arredondar deslocaria o trecho);
+// depois o bit (e, com x como eixo maior, o byte) do pixel atual anda junto com o ponto, sem recalcular índice e
+// máscara a cada passo, e a escrita e as faixas sujas são agrupadas por byte (eixo y) ou por página (eixo x)
+static void ssd1306_draw_line_clipped(uint8_t *ssd, ssd1306_dirty_t *dirty, const ssd1306_clip_t *clip, int x_0, int y_0, int x_1, int y_1, bool set) {
+    int code_0 = ssd1306_outcode(clip, x_0, y_0);
+    int code_1 = ssd1306_outcode(clip, x_1, y_1);
+    ssd1306_draw_mode_t mode = set ? ssd1306_draw_or : ssd1306_draw_and_not;
+
+    if (code_0 & code_1) {
+        return; // As duas pontas do mesmo lado de fora do recorte
+    }
+    if (y_0 == y_1) {
+        ssd1306_rect_op(ssd, dirty, clip, x_0 < x_1 ? x_0 : x_1, y_0, abs(x_1 - x_0) + 1, 1, mode);
+        return;
+    }
+    if (x_0 == x_1) {
+        ssd1306_rect_op(ssd, dirty, clip, x_0, y_0 < y_1 ? y_0 : y_1, 1, abs(y_1 - y_0) + 1, mode);
+        return;
+    }
+
+    int dx = abs(x_1 - x_0); // Deslocamentos
+    int dy = abs(y_1 - y_0);
+    int sx = x_0 < x_1 ? 1 : -1; // Direção de avanço
+    int sy = y_0 < y_1 ? 1 : -1;
+    bool x_major = dx >= dy;
+    int major = x_major ? dx : dy;
+    int minor = x_major ? dy : dx;
+
+    // Passos em que as duas coordenadas estão no recorte (todos, se as duas pontas estiverem dentro)
+    int64_t first = 0, last = major;
+    if (code_0 | code_1) {
+        int64_t low, high, minor_low, minor_high;
+
+        ssd1306_axis_range(x_major ? x_0 : y_0, x_major ? sx : sy, x_major ? clip->x_0 : clip->y_0, x_major ? clip->x_1 : clip->y_1, &low, &high);
+        first = low > first ? low : first;
+        last = high < last ? high : last;
+
+        // Avanço k do eixo menor -> primeiro passo com avanço >= k e último com avanço <= k
+        ssd1306_axis_range(x_major ? y_0 : x_0, x_major ? sy : sx, x_major ? clip->y_0 : clip->x_0, x_major ? clip->y_1 : clip->x_1, &minor_low, &minor_high);
+        low = ssd1306_div_ceil((int64_t)2 * major * minor_low - major, (int64_t)2 * minor);
+        high = ssd1306_div_ceil((int64_t)2 * major * minor_high + major, (int64_t)2 * minor) - 1;
+        first = low > first ? low : first;
+        last = high < last ? high : last;
+
+        if (first > last) {
+            return;
+        }
+    }
+
+    // Estado no primeiro passo visível: avanço do eixo menor e resto (erro acumulado, em [0, 2 * major))
+    int64_t numerator = (int64_t)2 * minor * first + major;
+    int advance = (int)(numerator / (2 * major));
+    int error = (int)(numerator - (int64_t)2 * major * advance);
+    int steps = (int)(last - first);
+
+    int x = x_major ? x_0 + sx * (int)first : x_0 + sx * advance;
+    int y = x_major ? y_0 + sy * advance : y_0 + sy * (int)first;
+    int page = y / 8;
+    uint8_t bit = (uint8_t)(1 << (y & 7));
+    uint8_t first_bit = sy > 0 ? 0x01 : 0x80; // Primeiro bit de uma página no sentido de avanço em y
+    uint8_t set_bits = set ? 0xFF : 0x00;
+
+    if (x_major) {
+        // Um pixel por coluna: cada passo cai num byte diferente, mas as colunas alteradas de uma página
+        // formam um intervalo, marcado como sujo uma vez só, quando a linha troca de página (e no fim)
+        uint8_t *byte = &ssd[page * ssd1306_width + x];
+        int first_x = -1, last_x = -1;
+
+        while (true) {
+            uint8_t old = *byte;
+            uint8_t value = (uint8_t)((old & ~bit) | (bit & set_bits));
+            *byte = value;
+            if (value != old) {
+                first_x = first_x < 0 ? x : first_x;
+                last_x = x;
+            }
+            if (steps-- == 0) {
+                break;
+            }
+
+            x += sx;
+            byte += sx;
+            error += 2 * minor;
+            if (error >= 2 * major) {
+                error -= 2 * major;
+                bit = ssd1306_next_bit(bit, sy);
+                if (!bit) {
+                    if (first_x >= 0) {
+                        ssd1306_dirty_mark(dirty, page, first_x);
+                        ssd1306_dirty_mark(dirty, page, last_x);
+                        first_x = -1;
+                    }
+                    bit = first_bit;
+                    page += sy;
+                    byte += sy * ssd1306_width;
+                }
+            }
+        }
+        if (first_x >= 0) {
+            ssd1306_dirty_mark(dirty, page, first_x);
+            ssd1306_dirty_mark(dirty, page, last_x);
+        }
+        return;
+    }
+
+    // Vários pixels por byte: os bits da coluna são acumulados e aplicados ao byte de uma vez,
+    // quando a linha troca de coluna ou de página (e no fim)
+    uint8_t bits = 0;
+
+    while (true) {
+        bits |= bit;
+        if (steps-- == 0) {
+            break;
+        }
+
+        error += 2 * minor;
+        bool minor_step = error >= 2 * major;
+        if (minor_step) {
+            error -= 2 * major;
+        }
+
+        uint8_t next = ssd1306_next_bit(bit, sy);
+        if (minor_step || !next) {
+            ssd1306_blend_byte(ssd, dirty, page, x, bits & set_bits, bits, ssd1306_draw_opaque);
+            bits = 0;
+        }
+        if (minor_step) {
+            x += sx;
+        }
+        if (next) {
+            bit = next;
+        }
+        else {
+            bit = first_bit;
+            page += sy;
+        }
+    }
+    ssd1306_blend_byte(ssd, dirty, page, x, bits & set_bits, bits, ssd1306_draw_opaque);
+}
+
+// Linha entre dois pontos quaisquer, recortada à tela (ver ssd1306_draw_line_clipped)
+void ssd1306_draw_line(uint8_t *ssd, int x_0, int y_0, int x_1, int y_1, bool set) {
+    ssd1306_draw_line_clipped(ssd, NULL, &ssd1306_screen_clip, x_0, y_0, x_1, y_1, set);
+}
+
+// Prepara um contexto de desenho no framebuffer ssd, com o recorte cobrindo a tela inteira
+// O desenho não marca faixas sujas, a não ser que ctx->dirty aponte para as faixas do buffer
+void ssd1306_ctx_init(ssd1306_context_t *ctx, uint8_t *ssd) {
+    ctx->ssd = ssd;
+    ctx->dirty = NULL;
+    ctx->depth = 0;
+    ctx->clip[0] = ssd1306_screen_clip;
+}
+
+// Prepara um contexto de desenho em fb, acumulando as colunas alteradas em fb->dirty
+void ssd1306_ctx_init_framebuffer(ssd1306_context_t *ctx, ssd1306_framebuffer_t *fb) {
+    ssd1306_ctx_init(ctx, fb->data);
+    ctx->dirty = &fb->dirty;
+}
+
+// Empilha um recorte: a interseção do retângulo com o recorte atual (um widget não desenha fora da sua janela,
+// nem fora da janela de quem o contém); retorna false, sem mudar nada, se a pilha estiver cheia
+bool ssd1306_ctx_push_clip(ssd1306_context_t *ctx, int x, int y, int width, int height) {
+    if (ctx->depth + 1 >= ssd1306_clip_stack_depth) {
+        return false;
+    }
+
+    const ssd1306_clip_t *current = &ctx->clip[ctx->depth];
+    ssd1306_clip_t *clip = &ctx->clip[++ctx->depth];
+    int x_1 = x + width - 1;
+    int y_1 = y + height - 1;
+
+    clip->x_0 = (int16_t)(x > current->x_0 ? x : current->x_0);
+    clip->y_0 = (int16_t)(y > current->y_0 ? y : current->y_0);
+    clip->x_1 = (int16_t)(x_1 < current->x_1 ? x_1 : current->x_1);
+    clip->y_1 = (int16_t)(y_1 < current->y_1 ? y_1 : current->y_1);
+
+    // Recorte vazio: mantém x_0 > x_1 com valores dentro da tela, para nenhum laço chegar a começar
+    if (clip->x_0 > clip->x_1 || clip->y_0 > clip->y_1) {
+        clip->x_0 = 1;
+        clip->x_1 = 0;
+        clip->y_0 = 1;
+        clip->y_1 = 0;
+    }
+    return true;
+}
+
+// Volta ao recorte anterior (o da tela inteira nunca é desempilhado)
+void ssd1306_ctx_pop_clip(ssd1306_context_t *ctx) {
+    if (ctx->depth > 0) {
+        ctx->depth--;
+    }
+}
+
+// Recorte atual do contexto
+static inline const ssd1306_clip_t *ssd1306_ctx_clip(const ssd1306_context_t *ctx) {
+    return &ctx->clip[ctx->depth];
+}
+
+// Acende ou apaga um pixel, ignorando-o se estiver fora do recorte
+void ssd1306_ctx_set_pixel(ssd1306_context_t *ctx, int x, int y, bool set) {
+    const ssd1306_clip_t *clip = ssd1306_ctx_clip(ctx);
+
+    if (x >= clip->x_0 && x <= clip->x_1 && y >= clip->y_0 && y <= clip->y_1) {
+        ssd1306_put_pixel(ctx->ssd, ctx->dirty, x, y, set);
+    }
+}
+
+// Versões de ssd1306_fill_rect, ssd1306_clear_rect e ssd1306_invert_rect recortadas ao contexto
+void ssd1306_ctx_fill_rect(ssd1306_context_t *ctx, int x, int y, int width, int height, bool set) {
+    ssd1306_rect_op(ctx->ssd, ctx->dirty, ssd1306_ctx_clip(ctx), x, y, width, height, set ? ssd1306_draw_or : ssd1306_draw_and_not);
+}
+
+void ssd1306_ctx_clear_rect(ssd1306_context_t *ctx, int x, int y, int width, int height) {
+    ssd1306_rect_op(ctx->ssd, ctx->dirty, ssd1306_ctx_clip(ctx), x, y, width, height, ssd1306_draw_and_not);
+}
+
+void ssd1306_ctx_invert_rect(ssd1306_context_t *ctx, int x, int y, int width, int height) {
+    ssd1306_rect_op(ctx->ssd, ctx->dirty, ssd1306_ctx_clip(ctx), x, y, width, height, ssd1306_draw_xor);
+}
+
+// Linhas recortadas ao contexto
+void ssd1306_ctx_draw_hline(ssd1306_context_t *ctx, int x, int y, int width, bool set) {
+    ssd1306_ctx_fill_rect(ctx, x, y, width, 1, set);
+}
+
+void ssd1306_ctx_draw_vline(ssd1306_context_t *ctx, int x, int y, int height, bool set) {
+    ssd1306_ctx_fill_rect(ctx, x, y, 1, height, set);
+}
+
+void ssd1306_ctx_draw_line(ssd1306_context_t *ctx, int x_0, int y_0, int x_1, int y_1, bool set) {
+    ssd1306_draw_line_clipped(ctx->ssd, ctx->dirty, ssd1306_ctx_clip(ctx), x_0, y_0, x_1, y_1, set);
+}
+
+// Cópia de outro buffer e glifo, recortados ao contexto
+void ssd1306_ctx_blit(ssd1306_context_t *ctx, int x, int y, const uint8_t *src, int src_width, int src_x, int src_y, int width, int height, ssd1306_draw_mode_t mode) {
+    ssd1306_blit_clipped(ctx->ssd, ctx->dirty, ssd1306_ctx_clip(ctx), x, y, src, src_width, src_x, src_y, width, height, mode);
+}
+
+void ssd1306_ctx_draw_glyph(ssd1306_context_t *ctx, int x, int y, const uint8_t *glyph, int width, int height, ssd1306_draw_mode_t mode) {
+    ssd1306_draw_glyph_clipped(ctx->ssd, ctx->dirty, ssd1306_ctx_clip(ctx), x, y, glyph, width, height, mode);
+}
+
+// Desenha um único caractere no display, em qualquer posição, com o modo de combinação escolhido
+// A parte que ficar fora da tela é recortada
+void ssd1306_draw_char_mode(uint8_t *ssd, int16_t x, int16_t y, uint8_t character, ssd1306_draw_mode_t mode) {
+    ssd1306_draw_glyph(ssd, x, y, &font[ssd1306_get_font(character)], 8, 8, mode);
+}
+
+// Desenha um único caractere no display (substituindo o fundo)
+void ssd1306_draw_char(uint8_t *ssd, int16_t x, int16_t y, uint8_t character) {
+    ssd1306_draw_char_mode(ssd, x, y, character, ssd1306_draw_opaque);
+}
+
+// Lê o próximo caractere da string, convertendo U+0080..U+00FF em UTF-8 (0xC2/0xC3 + continuação) para Latin-1
+// Assim textos acentuados escritos no código-fonte (UTF-8) caem direto no glifo certo da fonte
+// end limita a leitura (strings sem '\0'); NULL para strings terminadas em '\0'
+static inline uint8_t ssd1306_next_char(const char **string, const char *end) {
+    const uint8_t *s = (const uint8_t *)*string;
+
+    if ((s[0] == 0xC2 || s[0] == 0xC3) && (end == NULL || *string + 1 < end) && (s[1] & 0xC0) == 0x80) {
+        *string += 2;
+        return (uint8_t)((s[0] & 0x03) << 6 | (s[1] & 0x3F));
+    }
+    *string += 1;
+    return s[0];
+}
+
+// Desenha uma string com o modo de combinação escolhido, chamando a função de desenhar caractere várias vezes
+void ssd1306_draw_string_mode(uint8_t *ssd, int16_t x, int16_t y, const char *string, ssd1306_draw_mode_t mode) {
+    if (x >= ssd1306_width || y <= -8 || y >= ssd1306_height) {
+        return;
+    }
+
+    while (*string && x < ssd1306_width) {
+        ssd1306_draw_char_mode(ssd, x, y, ssd1306_next_char(&string, NULL), mode);
+        x += 8;
+    }
+}
+
+// Desenha os length primeiros bytes de uma string, que não precisa terminar em '\0'
+// (ex.: um trecho de um texto maior, sem copiá-lo para um buffer de linha)
+void ssd1306_draw_string_n(uint8_t *ssd, int16_t x, int16_t y, const char *string, size_t length) {
+    const char *end = string + length;
+
+    if (x >= ssd1306_width || y <= -8 || y >= ssd1306_height) {
+        return;
+    }
+
+    while (string < end && x < ssd1306_width) {
+        ssd1306_draw_char_mode(ssd, x, y, ssd1306_next_char(&string, end), ssd1306_draw_opaque);
+        x += 8;
+    }
+}
+
+// Desenha uma string, chamando a função de desenhar caractere várias vezes
+void ssd1306_draw_string(uint8_t *ssd, int16_t x, int16_t y, char *string) {
+    ssd1306_draw_string_mode(ssd, x, y, string, ssd1306_draw_opaque);
+}
+
+// Fonte 8x8 de ssd1306_font.h descrita como ssd1306_font_t (o espaço entre glifos já está na 8ª coluna)
+const ssd1306_font_t ssd1306_font_8x8 = {
+    .data = font,
+    .first_char = ssd1306_font_first_char,
+    .last_char = ssd1306_font_last_char,
+    .height = 8,
+    .fixed_width = 8,
+};
+
+// Fonte proporcional de ssd1306_font_prop.h (mesmos desenhos, sem as colunas vazias)
+const ssd1306_font_t ssd1306_font_proportional = {
+    .data = font_prop_data,
+    .offsets = font_prop_offsets,
+    .widths = font_prop_widths,
+    .first_char = ssd1306_font_first_char,
+    .last_char = ssd1306_font_last_char,
+    .height = 8,
+    .spacing = 1,
+};
+
+// Localiza o glifo de um caractere; caracteres fora da fonte usam o espaço (ou o primeiro glifo)
+static inline const uint8_t *ssd1306_font_glyph(const ssd1306_font_t *font, uint8_t character, int *width) {
+    if (character < font->first_char || character > font->last_char) {
+        character = (' ' >= font->first_char && ' ' <= font->last_char) ? ' ' : font->first_char;
+    }
+
+    int idx = character - font->first_char;
+    int pages = (font->height + 7) / 8;
+
+    if (font->widths == NULL) {
+        *width = font->fixed_width;
+        return font->data + (font->offsets ? font->offsets[idx] : idx * font->fixed_width * pages);
+    }
+    *width = font->widths[idx];
+    return font->data + font->offsets[idx];
+}
+
+// Desenha um caractere com a fonte escolhida e retorna quantas colunas ele ocupa (glifo + espaçamento)
+// No modo opaco as colunas de espaçamento também são apagadas
+static int ssd1306_draw_char_font_clipped(uint8_t *ssd, ssd1306_dirty_t *dirty, const ssd1306_clip_t *clip, int x, int y, uint8_t character, const ssd1306_font_t *font, ssd1306_draw_mode_t mode) {
+    int width;
+    const uint8_t *glyph = ssd1306_font_glyph(font, character, &width);
+
+    ssd1306_draw_glyph_clipped(ssd, dirty, clip, x, y, glyph, width, font->height, mode);
+
+    if (mode == ssd1306_draw_opaque) {
+        ssd1306_rect_op(ssd, dirty, clip, x + width, y, font->spacing, font->height, ssd1306_draw_and_not);
+    }
+    return width + font->spacing;
+}
+
+// Desenha os caracteres de string até end (ou até o '\0', com end NULL) com a fonte escolhida
+// Caracteres inteiros antes do recorte só avançam x; o desenho para no primeiro que começa depois dele
+static int ssd1306_draw_span_font(uint8_t *ssd, ssd1306_dirty_t *dirty, const ssd1306_clip_t *clip, int x, int y, const char *string, const char *end, const ssd1306_font_t *font, ssd1306_draw_mode_t mode) {
+    if (y + font->height - 1 < clip->y_0 || y > clip->y_1) {
+        return x;
+    }
+
+    while ((end ? string < end : *string) && x <= clip->x_1) {
+        x += ssd1306_draw_char_font_clipped(ssd, dirty, clip, x, y, ssd1306_next_char(&string, end), font, mode);
+    }
+    return x;
+}
+
+// Desenha um caractere com a fonte escolhida (recortado à tela) e retorna quantas colunas ele ocupa
+int ssd1306_draw_char_font(uint8_t *ssd, int16_t x, int16_t y, uint8_t character, const ssd1306_font_t *font, ssd1306_draw_mode_t mode) {
+    return ssd1306_draw_char_font_clipped(ssd, NULL, &ssd1306_screen_clip, x, y, character, font, mode);
+}
+
+// Desenha uma string avançando pela largura real de cada glifo; retorna o x logo após o último caractere
+int ssd1306_draw_string_font(uint8_t *ssd, int16_t x, int16_t y, const char *string, const ssd1306_font_t *font, ssd1306_draw_mode_t mode) {
+    return ssd1306_draw_span_font(ssd, NULL, &ssd1306_screen_clip, x, y, string, NULL, font, mode);
+}
+
+// Igual a ssd1306_draw_string_font, mas só com os length primeiros bytes da string (que não precisa terminar em '\0')
+int ssd1306_draw_string_font_n(uint8_t *ssd, int16_t x, int16_t y, const char *string, size_t length, const ssd1306_font_t *font, ssd1306_draw_mode_t mode) {
+    return ssd1306_draw_span_font(ssd, NULL, &ssd1306_screen_clip, x, y, string, string + length, font, mode);
+}
+
+// Texto recortado ao contexto (ex.: um rótulo que não pode invadir o widget vizinho)
+int ssd1306_ctx_draw_char_font(ssd1306_context_t *ctx, int x, int y, uint8_t character, const ssd1306_font_t *font, ssd1306_draw_mode_t mode) {
+    return ssd1306_draw_char_font_clipped(ctx->ssd, ctx->dirty, ssd1306_ctx_clip(ctx), x, y, character, font, mode);
+}
+
+int ssd1306_ctx_draw_string_font(ssd1306_context_t *ctx, int x, int y, const char *string, const ssd1306_font_t *font, ssd1306_draw_mode_t mode) {
+    return ssd1306_draw_span_font(ctx->ssd, ctx->dirty, ssd1306_ctx_clip(ctx), x, y, string, NULL, font, mode);
+}
+
+int ssd1306_ctx_draw_string_font_n(ssd1306_context_t *ctx, int x, int y, const char *string, size_t length, const ssd1306_font_t *font, ssd1306_draw_mode_t mode) {
+    return ssd1306_draw_span_font(ctx->ssd, ctx->dirty, ssd1306_ctx_clip(ctx), x, y, string, string + length, font, mode);
+}
+
+// Mede os caracteres de string até end (ou até o '\0', com end NULL), sem o espaçamento após o último
+static int ssd1306_measure_span(const char *string, const char *end, const ssd1306_font_t *font) {
+    int total = 0;
+
+    while (end ? string < end : *string) {
+        int width;
+        ssd1306_font_glyph(font, ssd1306_next_char(&string, end), &width);
+        total += width + font->spacing;
+    }
+    return total > 0 ? total - font->spacing : 0;
+}
+
+// Mede a largura em pixels de uma string na fonte escolhida (sem o espaçamento após o último caractere)
+int ssd1306_measure_string(const char *string, const ssd1306_font_t *font) {
+    return ssd1306_measure_span(string, NULL, font);
+}
+
+// Mede a largura em pixels dos length primeiros bytes de uma string
+int ssd1306_measure_string_n(const char *string, size_t length, const ssd1306_font_t *font) {
+    return ssd1306_measure_span(string, string + length, font);
+}
+
+// Quantos bytes do início da string cabem em max_width pixels (sem cortar um caractere UTF-8 ao meio)
+size_t ssd1306_fit_string_n(const char *string, size_t length, const ssd1306_font_t *font, int max_width) {
+    const char *p = string;
+    const char *end = string + length;
+    int used = 0;
+
+    while (p < end) {
+        const char *c = p;
+        int width;
+        ssd1306_font_glyph(font, ssd1306_next_char(&p, end), &width);
+
+        if (used + width > max_width) {
+            return c - string;
+        }
+        used += width + font->spacing;
+    }
+    return length;
+}
+
+// Prepara a quebra de um texto em linhas de até width pixels na fonte escolhida
+void ssd1306_text_lines_init(ssd1306_text_lines_t *lines, const char *text, const ssd1306_font_t *font, int width) {
+    lines->text = text;
+    lines->font = font;
+    lines->width = width;
+}
+
+// Devolve a próxima linha como um trecho (início, tamanho) do próprio texto, sem copiar nada
+// A linha termina no '\n' ou, se não couber, no último espaço (ou no meio da palavra, se ela sozinha não couber);
+// depois de uma quebra automática, os espaços e um '\n' logo em seguida são descartados
+bool ssd1306_text_lines_next(ssd1306_text_lines_t *lines, const char **line, size_t *length) {
+    const ssd1306_font_t *font = lines->font;
+    const char *start = lines->text;
+    const char *p = start;
+    const char *wrap = NULL;
+    int used = 0;
+
+    if (!*start) {
+        return false;
+    }
+
+    while (*p && *p != '\n') {
+        const char *c = p;
+        int width;
+        ssd1306_font_glyph(font, ssd1306_next_char(&p, NULL), &width);
+
+        if (*c == ' ') {
+            wrap = c;
+        }
+        if (used + width > lines->width && c > start) {
+            const char *end = wrap > start ? wrap : c;
+            const char *next = end;
+
+            while (*next == ' ') {
+                next++;
+            }
+            if (*next == '\n') {
+                next++;
+            }
+
+            *line = start;
+            *length = end - start;
+            lines->text = next;
+            return true;
+        }
+        used += width + font->spacing;
+    }
+
+    *line = start;
+    *length = p - start;
+    lines->text = *p ? p + 1 : p;
+    return true;
+}
+
+// Descompacta um quadro RLE (gerado por tools/page_baker --rle) em dst, até preencher length bytes
+// Cada bloco começa com um byte de cabeçalho h:
+// - h & 0x80: repetição; o próximo byte se repete (h & 0x7F) + 1 vezes
+// - senão: literal; os próximos h + 1 bytes são copiados como estão
+void ssd1306_rle_decode(const uint8_t *src, uint8_t *dst, int length) {
+    uint8_t *end = dst + length;
+
+    while (dst < end) {
+        uint8_t header = *src++;
+        int count = (header & 0x7F) + 1;
+        if (count > end - dst) {
+            count = end - dst;
+        }
+
+        if (header & 0x80) {
+            memset(dst, *src++, count);
+        }
+        else {
+            memcpy(dst, src, count);
+            src += count;
+        }
+        dst += count;
+    }
+}
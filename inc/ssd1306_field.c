@@ -0,0 +1,103 @@
+#include <string.h>
+#include "pico/stdlib.h"
+#include "hardware/i2c.h"
+#include "ssd1306_i2c.h"
+#include "ssd1306.h"
+
+// Campo numérico: um valor (inteiro ou ponto fixo) desenhado em células de largura fixa.
+// O campo lembra o que já está no framebuffer e, a cada valor novo, redesenha só as células
+// cujos caracteres mudaram; assim só essas colunas ficam sujas e seguem para o display.
+
+// Escreve value em out (sem '\0') com decimals casas decimais: 1234 com 2 casas -> "12.34", -5 com 1 -> "-0.5"
+// Não usa printf; retorna a quantidade de caracteres (no máximo 12)
+int ssd1306_format_fixed(char *out, int32_t value, int decimals) {
+    char digits[12];
+    int count = 0;
+    uint32_t magnitude = value < 0 ? 0u - (uint32_t)value : (uint32_t)value;
+
+    if (decimals > 9) {
+        decimals = 9;
+    }
+
+    // Algarismos do menos para o mais significativo, com pelo menos um antes da vírgula
+    do {
+        digits[count++] = (char)('0' + magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude || count <= decimals);
+
+    int length = 0;
+    if (value < 0) {
+        out[length++] = '-';
+    }
+    while (count > 0) {
+        if (count == decimals) {
+            out[length++] = '.';
+        }
+        out[length++] = digits[--count];
+    }
+    return length;
+}
+
+// Prepara um campo de cells caracteres a partir de (x, y), alinhado à direita
+// A célula tem a largura do algarismo mais largo da fonte, para os números não "dançarem" ao mudar
+void ssd1306_number_field_init(ssd1306_number_field_t *field, const ssd1306_font_t *font, int x, int y, int cells, int decimals) {
+    field->font = font;
+    field->x = x;
+    field->y = y;
+    field->cells = cells < ssd1306_field_max_cells ? cells : ssd1306_field_max_cells;
+    field->decimals = decimals;
+    field->valid = false;
+
+    int widest = 0;
+    for (char digit = '0'; digit <= '9'; digit++) {
+        int width = ssd1306_measure_string_n(&digit, 1, font);
+        widest = width > widest ? width : widest;
+    }
+    field->cell_width = widest + font->spacing;
+}
+
+// O conteúdo do framebuffer sob o campo foi trocado (ex.: quadro apagado): o próximo set redesenha tudo
+void ssd1306_number_field_invalidate(ssd1306_number_field_t *field) {
+    field->valid = false;
+}
+
+// Largura total do campo, em pixels
+int ssd1306_number_field_width(const ssd1306_number_field_t *field) {
+    return field->cells * field->cell_width;
+}
+
+// Mostra value no campo, redesenhando só as células que mudaram; retorna quantas foram redesenhadas
+// Se o número não couber nas células, o campo mostra só traços
+int ssd1306_number_field_set(uint8_t *ssd, ssd1306_number_field_t *field, int32_t value) {
+    const ssd1306_font_t *font = field->font;
+    char formatted[12];
+    char text[ssd1306_field_max_cells];
+
+    int length = ssd1306_format_fixed(formatted, value, field->decimals);
+    if (length > field->cells) {
+        memset(text, '-', field->cells);
+    }
+    else {
+        memset(text, ' ', field->cells - length);
+        memcpy(text + field->cells - length, formatted, length);
+    }
+
+    int redrawn = 0;
+    for (int i = 0; i < field->cells; i++) {
+        if (field->valid && field->drawn[i] == text[i]) {
+            continue;
+        }
+
+        // Apaga a célula e desenha o novo caractere centralizado nela
+        int cell_x = field->x + i * field->cell_width;
+        ssd1306_clear_rect(ssd, cell_x, field->y, field->cell_width, font->height);
+        int width = ssd1306_measure_string_n(&text[i], 1, font);
+        ssd1306_draw_string_font_n(ssd, cell_x + (field->cell_width - font->spacing - width) / 2, field->y, &text[i], 1, font, ssd1306_draw_or);
+
+        field->drawn[i] = text[i];
+        redrawn++;
+    }
+
+    field->valid = true;
+    return redrawn;
+}
@@ -1,6 +1,43 @@
+// Fonte 8x8 (coluna por byte, bit 0 = pixel de cima) para os caracteres 0x20 a 0xFF (ASCII + Latin-1)
+// Guardada em flash (const); o glifo do caractere c começa em font[(c - ssd1306_font_first_char) * 8]
+// De 0x7F a 0x9F (DEL e controles C1) os glifos são vazios
+#define ssd1306_font_first_char 0x20
+#define ssd1306_font_last_char 0xFF
 
-static uint8_t font[] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // Nothing
+static const uint8_t font[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // Espaço
+    0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x00, // !
+    0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, // "
+    0x00, 0x14, 0x7f, 0x14, 0x7f, 0x14, 0x00, 0x00, // #
+    0x00, 0x24, 0x2a, 0x7f, 0x2a, 0x12, 0x00, 0x00, // $
+    0x00, 0x23, 0x13, 0x08, 0x64, 0x62, 0x00, 0x00, // %
+    0x00, 0x36, 0x49, 0x55, 0x22, 0x50, 0x00, 0x00, // &
+    0x00, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, // '
+    0x00, 0x00, 0x1c, 0x22, 0x41, 0x00, 0x00, 0x00, // (
+    0x00, 0x00, 0x41, 0x22, 0x1c, 0x00, 0x00, 0x00, // )
+    0x00, 0x14, 0x08, 0x3e, 0x08, 0x14, 0x00, 0x00, // *
+    0x00, 0x08, 0x08, 0x3e, 0x08, 0x08, 0x00, 0x00, // +
+    0x00, 0x00, 0xa0, 0x60, 0x00, 0x00, 0x00, 0x00, // ,
+    0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, // -
+    0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, // .
+    0x00, 0x20, 0x10, 0x08, 0x04, 0x02, 0x00, 0x00, // /
+    0x3e, 0x41, 0x41, 0x49, 0x41, 0x41, 0x3e, 0x00, // 0
+    0x00, 0x00, 0x42, 0x7f, 0x40, 0x00, 0x00, 0x00, // 1
+    0x30, 0x49, 0x49, 0x49, 0x49, 0x46, 0x00, 0x00, // 2
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x36, 0x00, // 3
+    0x3f, 0x20, 0x20, 0x78, 0x20, 0x20, 0x00, 0x00, // 4
+    0x4f, 0x49, 0x49, 0x49, 0x49, 0x30, 0x00, 0x00, // 5
+    0x3f, 0x48, 0x48, 0x48, 0x48, 0x48, 0x30, 0x00, // 6
+    0x01, 0x01, 0x01, 0x61, 0x31, 0x0d, 0x03, 0x00, // 7
+    0x36, 0x49, 0x49, 0x49, 0x49, 0x49, 0x36, 0x00, // 8
+    0x06, 0x09, 0x09, 0x09, 0x09, 0x09, 0x7f, 0x00, // 9
+    0x00, 0x00, 0x36, 0x36, 0x00, 0x00, 0x00, 0x00, // :
+    0x00, 0x00, 0x56, 0x36, 0x00, 0x00, 0x00, 0x00, // ;
+    0x00, 0x08, 0x14, 0x22, 0x41, 0x00, 0x00, 0x00, // <
+    0x00, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00, 0x00, // =
+    0x00, 0x00, 0x41, 0x22, 0x14, 0x08, 0x00, 0x00, // >
+    0x00, 0x02, 0x01, 0x51, 0x09, 0x06, 0x00, 0x00, // ?
+    0x00, 0x3e, 0x41, 0x5d, 0x55, 0x1e, 0x00, 0x00, // @
     0x78, 0x14, 0x12, 0x11, 0x12, 0x14, 0x78, 0x00, // A
     0x7f, 0x49, 0x49, 0x49, 0x49, 0x49, 0x7f, 0x00, // B
     0x7e, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x00, // C
@@ -27,14 +64,169 @@ static uint8_t font[] = {
     0x00, 0x41, 0x22, 0x14, 0x14, 0x22, 0x41, 0x00, // X
     0x01, 0x02, 0x04, 0x78, 0x04, 0x02, 0x01, 0x00, // Y
     0x41, 0x61, 0x59, 0x45, 0x43, 0x41, 0x00, 0x00, // Z
-    0x3e, 0x41, 0x41, 0x49, 0x41, 0x41, 0x3e, 0x00, // 0
-    0x00, 0x00, 0x42, 0x7f, 0x40, 0x00, 0x00, 0x00, // 1
-    0x30, 0x49, 0x49, 0x49, 0x49, 0x46, 0x00, 0x00, // 2
-    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x36, 0x00, // 3
-    0x3f, 0x20, 0x20, 0x78, 0x20, 0x20, 0x00, 0x00, // 4
-    0x4f, 0x49, 0x49, 0x49, 0x49, 0x30, 0x00, 0x00, // 5
-    0x3f, 0x48, 0x48, 0x48, 0x48, 0x48, 0x30, 0x00, // 6
-    0x01, 0x01, 0x01, 0x61, 0x31, 0x0d, 0x03, 0x00, // 7
-    0x36, 0x49, 0x49, 0x49, 0x49, 0x49, 0x36, 0x00, // 8
-    0x06, 0x09, 0x09, 0x09, 0x09, 0x09, 0x7f, 0x00, // 9
-};
\ No newline at end of file
+    0x00, 0x00, 0x7f, 0x41, 0x41, 0x00, 0x00, 0x00, // [
+    0x00, 0x02, 0x04, 0x08, 0x10, 0x20, 0x00, 0x00, // Barra invertida
+    0x00, 0x00, 0x41, 0x41, 0x7f, 0x00, 0x00, 0x00, // ]
+    0x00, 0x04, 0x02, 0x01, 0x02, 0x04, 0x00, 0x00, // ^
+    0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, // _
+    0x00, 0x00, 0x01, 0x02, 0x04, 0x00, 0x00, 0x00, // `
+    0x00, 0x20, 0x54, 0x54, 0x54, 0x78, 0x00, 0x00, // a
+    0x00, 0x7f, 0x48, 0x44, 0x44, 0x38, 0x00, 0x00, // b
+    0x00, 0x38, 0x44, 0x44, 0x44, 0x20, 0x00, 0x00, // c
+    0x00, 0x38, 0x44, 0x44, 0x48, 0x7f, 0x00, 0x00, // d
+    0x00, 0x38, 0x54, 0x54, 0x54, 0x18, 0x00, 0x00, // e
+    0x00, 0x08, 0x7e, 0x09, 0x01, 0x02, 0x00, 0x00, // f
+    0x00, 0x18, 0xa4, 0xa4, 0xa4, 0x7c, 0x00, 0x00, // g
+    0x00, 0x7f, 0x08, 0x04, 0x04, 0x78, 0x00, 0x00, // h
+    0x00, 0x00, 0x44, 0x7d, 0x40, 0x00, 0x00, 0x00, // i
+    0x00, 0x40, 0x80, 0x84, 0x7d, 0x00, 0x00, 0x00, // j
+    0x00, 0x7f, 0x10, 0x28, 0x44, 0x00, 0x00, 0x00, // k
+    0x00, 0x00, 0x41, 0x7f, 0x40, 0x00, 0x00, 0x00, // l
+    0x00, 0x7c, 0x04, 0x78, 0x04, 0x78, 0x00, 0x00, // m
+    0x00, 0x7c, 0x08, 0x04, 0x04, 0x78, 0x00, 0x00, // n
+    0x00, 0x38, 0x44, 0x44, 0x44, 0x38, 0x00, 0x00, // o
+    0x00, 0xfc, 0x24, 0x24, 0x24, 0x18, 0x00, 0x00, // p
+    0x00, 0x18, 0x24, 0x24, 0x24, 0xfc, 0x00, 0x00, // q
+    0x00, 0x7c, 0x08, 0x04, 0x04, 0x08, 0x00, 0x00, // r
+    0x00, 0x48, 0x54, 0x54, 0x54, 0x24, 0x00, 0x00, // s
+    0x00, 0x04, 0x3f, 0x44, 0x40, 0x20, 0x00, 0x00, // t
+    0x00, 0x3c, 0x40, 0x40, 0x20, 0x7c, 0x00, 0x00, // u
+    0x00, 0x1c, 0x20, 0x40, 0x20, 0x1c, 0x00, 0x00, // v
+    0x00, 0x3c, 0x40, 0x38, 0x40, 0x3c, 0x00, 0x00, // w
+    0x00, 0x44, 0x28, 0x10, 0x28, 0x44, 0x00, 0x00, // x
+    0x00, 0x1c, 0xa0, 0xa0, 0xa0, 0x7c, 0x00, 0x00, // y
+    0x00, 0x44, 0x64, 0x54, 0x4c, 0x44, 0x00, 0x00, // z
+    0x00, 0x00, 0x08, 0x36, 0x41, 0x41, 0x00, 0x00, // {
+    0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, // |
+    0x00, 0x41, 0x41, 0x36, 0x08, 0x00, 0x00, 0x00, // }
+    0x00, 0x08, 0x04, 0x08, 0x10, 0x08, 0x00, 0x00, // ~
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x7F
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x80
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x81
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x82
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x83
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x84
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x85
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x86
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x87
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x88
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x89
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x8A
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x8B
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x8C
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x8D
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x8E
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x8F
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x90
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x91
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x92
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x93
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x94
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x95
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x96
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x97
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x98
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x99
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x9A
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x9B
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x9C
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x9D
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x9E
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x9F
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xA0 NBSP
+    0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x00, // 0xA1 ¡
+    0x00, 0x1c, 0x22, 0x7f, 0x22, 0x10, 0x00, 0x00, // 0xA2 ¢
+    0x00, 0x48, 0x3e, 0x49, 0x41, 0x22, 0x00, 0x00, // 0xA3 £
+    0x00, 0x22, 0x1c, 0x14, 0x1c, 0x22, 0x00, 0x00, // 0xA4 ¤
+    0x00, 0x15, 0x16, 0x7c, 0x16, 0x15, 0x00, 0x00, // 0xA5 ¥
+    0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x00, // 0xA6 ¦
+    0x00, 0x0a, 0x55, 0x55, 0x55, 0x28, 0x00, 0x00, // 0xA7 §
+    0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, // 0xA8 ¨
+    0x1c, 0x22, 0x5d, 0x55, 0x55, 0x22, 0x1c, 0x00, // 0xA9 ©
+    0x00, 0x48, 0x55, 0x55, 0x55, 0x5e, 0x00, 0x00, // 0xAA ª
+    0x00, 0x08, 0x14, 0x2a, 0x14, 0x22, 0x00, 0x00, // 0xAB «
+    0x00, 0x04, 0x04, 0x04, 0x04, 0x1c, 0x00, 0x00, // 0xAC ¬
+    0x00, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, // 0xAD SHY
+    0x1c, 0x22, 0x7d, 0x55, 0x69, 0x22, 0x1c, 0x00, // 0xAE ®
+    0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, // 0xAF ¯
+    0x00, 0x06, 0x09, 0x09, 0x06, 0x00, 0x00, 0x00, // 0xB0 °
+    0x00, 0x44, 0x44, 0x5f, 0x44, 0x44, 0x00, 0x00, // 0xB1 ±
+    0x00, 0x00, 0x09, 0x0d, 0x0a, 0x00, 0x00, 0x00, // 0xB2 ²
+    0x00, 0x00, 0x11, 0x15, 0x0a, 0x00, 0x00, 0x00, // 0xB3 ³
+    0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, // 0xB4 ´
+    0x00, 0xfc, 0x20, 0x40, 0x40, 0x3c, 0x00, 0x00, // 0xB5 µ
+    0x00, 0x06, 0x0f, 0x7f, 0x01, 0x7f, 0x00, 0x00, // 0xB6 ¶
+    0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, // 0xB7 ·
+    0x00, 0x00, 0x80, 0xa0, 0x40, 0x00, 0x00, 0x00, // 0xB8 ¸
+    0x00, 0x00, 0x0a, 0x0f, 0x08, 0x00, 0x00, 0x00, // 0xB9 ¹
+    0x00, 0x26, 0x29, 0x29, 0x29, 0x26, 0x00, 0x00, // 0xBA º
+    0x00, 0x22, 0x14, 0x2a, 0x14, 0x08, 0x00, 0x00, // 0xBB »
+    0x00, 0x27, 0x10, 0x28, 0x74, 0x22, 0x00, 0x00, // 0xBC ¼
+    0x00, 0x27, 0x10, 0x08, 0x74, 0x52, 0x00, 0x00, // 0xBD ½
+    0x00, 0x25, 0x17, 0x28, 0x74, 0x22, 0x00, 0x00, // 0xBE ¾
+    0x00, 0x30, 0x48, 0x45, 0x40, 0x20, 0x00, 0x00, // 0xBF ¿
+    0x00, 0x78, 0x15, 0x16, 0x14, 0x78, 0x00, 0x00, // 0xC0 À
+    0x00, 0x78, 0x14, 0x16, 0x15, 0x78, 0x00, 0x00, // 0xC1 Á
+    0x00, 0x78, 0x16, 0x15, 0x16, 0x78, 0x00, 0x00, // 0xC2 Â
+    0x00, 0x7a, 0x15, 0x17, 0x16, 0x79, 0x00, 0x00, // 0xC3 Ã
+    0x00, 0x78, 0x15, 0x14, 0x15, 0x78, 0x00, 0x00, // 0xC4 Ä
+    0x00, 0x78, 0x16, 0x15, 0x16, 0x78, 0x00, 0x00, // 0xC5 Å
+    0x00, 0x7e, 0x09, 0x7f, 0x49, 0x49, 0x00, 0x00, // 0xC6 Æ
+    0x00, 0x1e, 0xa1, 0x61, 0x21, 0x12, 0x00, 0x00, // 0xC7 Ç
+    0x00, 0x7c, 0x55, 0x56, 0x54, 0x44, 0x00, 0x00, // 0xC8 È
+    0x00, 0x7c, 0x54, 0x56, 0x55, 0x44, 0x00, 0x00, // 0xC9 É
+    0x00, 0x7c, 0x56, 0x55, 0x56, 0x44, 0x00, 0x00, // 0xCA Ê
+    0x00, 0x7c, 0x55, 0x54, 0x55, 0x44, 0x00, 0x00, // 0xCB Ë
+    0x00, 0x00, 0x45, 0x7e, 0x44, 0x00, 0x00, 0x00, // 0xCC Ì
+    0x00, 0x00, 0x44, 0x7e, 0x45, 0x00, 0x00, 0x00, // 0xCD Í
+    0x00, 0x00, 0x46, 0x7d, 0x46, 0x00, 0x00, 0x00, // 0xCE Î
+    0x00, 0x00, 0x45, 0x7c, 0x45, 0x00, 0x00, 0x00, // 0xCF Ï
+    0x00, 0x49, 0x7f, 0x49, 0x41, 0x3e, 0x00, 0x00, // 0xD0 Ð
+    0x00, 0x7e, 0x09, 0x13, 0x22, 0x7d, 0x00, 0x00, // 0xD1 Ñ
+    0x00, 0x38, 0x45, 0x46, 0x44, 0x38, 0x00, 0x00, // 0xD2 Ò
+    0x00, 0x38, 0x44, 0x46, 0x45, 0x38, 0x00, 0x00, // 0xD3 Ó
+    0x00, 0x38, 0x46, 0x45, 0x46, 0x38, 0x00, 0x00, // 0xD4 Ô
+    0x00, 0x3a, 0x45, 0x47, 0x46, 0x39, 0x00, 0x00, // 0xD5 Õ
+    0x00, 0x38, 0x45, 0x44, 0x45, 0x38, 0x00, 0x00, // 0xD6 Ö
+    0x00, 0x22, 0x14, 0x08, 0x14, 0x22, 0x00, 0x00, // 0xD7 ×
+    0x00, 0x3e, 0x61, 0x5d, 0x43, 0x3e, 0x00, 0x00, // 0xD8 Ø
+    0x00, 0x3c, 0x41, 0x42, 0x40, 0x3c, 0x00, 0x00, // 0xD9 Ù
+    0x00, 0x3c, 0x40, 0x42, 0x41, 0x3c, 0x00, 0x00, // 0xDA Ú
+    0x00, 0x3c, 0x42, 0x41, 0x42, 0x3c, 0x00, 0x00, // 0xDB Û
+    0x00, 0x3c, 0x41, 0x40, 0x41, 0x3c, 0x00, 0x00, // 0xDC Ü
+    0x00, 0x04, 0x08, 0x72, 0x09, 0x04, 0x00, 0x00, // 0xDD Ý
+    0x00, 0x7f, 0x12, 0x12, 0x12, 0x0c, 0x00, 0x00, // 0xDE Þ
+    0x00, 0x7e, 0x01, 0x49, 0x56, 0x20, 0x00, 0x00, // 0xDF ß
+    0x00, 0x20, 0x55, 0x56, 0x54, 0x78, 0x00, 0x00, // 0xE0 à
+    0x00, 0x20, 0x54, 0x56, 0x55, 0x78, 0x00, 0x00, // 0xE1 á
+    0x00, 0x20, 0x56, 0x55, 0x56, 0x78, 0x00, 0x00, // 0xE2 â
+    0x00, 0x22, 0x55, 0x57, 0x56, 0x79, 0x00, 0x00, // 0xE3 ã
+    0x00, 0x20, 0x55, 0x54, 0x55, 0x78, 0x00, 0x00, // 0xE4 ä
+    0x00, 0x20, 0x56, 0x55, 0x56, 0x78, 0x00, 0x00, // 0xE5 å
+    0x00, 0x24, 0x54, 0x38, 0x54, 0x58, 0x00, 0x00, // 0xE6 æ
+    0x00, 0x38, 0x44, 0xc4, 0x44, 0x20, 0x00, 0x00, // 0xE7 ç
+    0x00, 0x38, 0x55, 0x56, 0x54, 0x18, 0x00, 0x00, // 0xE8 è
+    0x00, 0x38, 0x54, 0x56, 0x55, 0x18, 0x00, 0x00, // 0xE9 é
+    0x00, 0x38, 0x56, 0x55, 0x56, 0x18, 0x00, 0x00, // 0xEA ê
+    0x00, 0x38, 0x55, 0x54, 0x55, 0x18, 0x00, 0x00, // 0xEB ë
+    0x00, 0x00, 0x45, 0x7e, 0x40, 0x00, 0x00, 0x00, // 0xEC ì
+    0x00, 0x00, 0x44, 0x7e, 0x41, 0x00, 0x00, 0x00, // 0xED í
+    0x00, 0x00, 0x46, 0x7d, 0x42, 0x00, 0x00, 0x00, // 0xEE î
+    0x00, 0x00, 0x45, 0x7c, 0x41, 0x00, 0x00, 0x00, // 0xEF ï
+    0x00, 0x20, 0x55, 0x52, 0x55, 0x38, 0x00, 0x00, // 0xF0 ð
+    0x00, 0x7e, 0x09, 0x07, 0x06, 0x79, 0x00, 0x00, // 0xF1 ñ
+    0x00, 0x38, 0x45, 0x46, 0x44, 0x38, 0x00, 0x00, // 0xF2 ò
+    0x00, 0x38, 0x44, 0x46, 0x45, 0x38, 0x00, 0x00, // 0xF3 ó
+    0x00, 0x38, 0x46, 0x45, 0x46, 0x38, 0x00, 0x00, // 0xF4 ô
+    0x00, 0x3a, 0x45, 0x47, 0x46, 0x39, 0x00, 0x00, // 0xF5 õ
+    0x00, 0x38, 0x45, 0x44, 0x45, 0x38, 0x00, 0x00, // 0xF6 ö
+    0x00, 0x08, 0x08, 0x2a, 0x08, 0x08, 0x00, 0x00, // 0xF7 ÷
+    0x00, 0x38, 0x64, 0x54, 0x4c, 0x38, 0x00, 0x00, // 0xF8 ø
+    0x00, 0x3c, 0x41, 0x42, 0x20, 0x7c, 0x00, 0x00, // 0xF9 ù
+    0x00, 0x3c, 0x40, 0x42, 0x21, 0x7c, 0x00, 0x00, // 0xFA ú
+    0x00, 0x3c, 0x42, 0x41, 0x22, 0x7c, 0x00, 0x00, // 0xFB û
+    0x00, 0x3c, 0x41, 0x40, 0x21, 0x7c, 0x00, 0x00, // 0xFC ü
+    0x00, 0x1c, 0xa0, 0xa2, 0xa1, 0x7c, 0x00, 0x00, // 0xFD ý
+    0x00, 0xff, 0x24, 0x24, 0x24, 0x18, 0x00, 0x00, // 0xFE þ
+    0x00, 0x1c, 0xa1, 0xa0, 0xa1, 0x7c, 0x00, 0x00, // 0xFF ÿ
+};
@@ -0,0 +1,231 @@
+// Fonte proporcional de 8 pixels de altura para os caracteres 0x20 a 0xFF, derivada de ssd1306_font.h
+// sem as colunas vazias das bordas; o espaço entre glifos é acrescentado pelo desenho (ssd1306_font_t::spacing)
+// O glifo do caractere c tem font_prop_widths[c - 0x20] colunas a partir de font_prop_data[font_prop_offsets[c - 0x20]]
+
+static const uint8_t font_prop_data[] = {
+    0x00, 0x00, // Espaço
+    0x5f, // !
+    0x07, 0x00, 0x07, // "
+    0x14, 0x7f, 0x14, 0x7f, 0x14, // #
+    0x24, 0x2a, 0x7f, 0x2a, 0x12, // $
+    0x23, 0x13, 0x08, 0x64, 0x62, // %
+    0x36, 0x49, 0x55, 0x22, 0x50, // &
+    0x04, 0x03, // '
+    0x1c, 0x22, 0x41, // (
+    0x41, 0x22, 0x1c, // )
+    0x14, 0x08, 0x3e, 0x08, 0x14, // *
+    0x08, 0x08, 0x3e, 0x08, 0x08, // +
+    0xa0, 0x60, // ,
+    0x08, 0x08, 0x08, 0x08, 0x08, // -
+    0x60, 0x60, // .
+    0x20, 0x10, 0x08, 0x04, 0x02, // /
+    0x3e, 0x41, 0x41, 0x49, 0x41, 0x41, 0x3e, // 0
+    0x42, 0x7f, 0x40, // 1
+    0x30, 0x49, 0x49, 0x49, 0x49, 0x46, // 2
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x36, // 3
+    0x3f, 0x20, 0x20, 0x78, 0x20, 0x20, // 4
+    0x4f, 0x49, 0x49, 0x49, 0x49, 0x30, // 5
+    0x3f, 0x48, 0x48, 0x48, 0x48, 0x48, 0x30, // 6
+    0x01, 0x01, 0x01, 0x61, 0x31, 0x0d, 0x03, // 7
+    0x36, 0x49, 0x49, 0x49, 0x49, 0x49, 0x36, // 8
+    0x06, 0x09, 0x09, 0x09, 0x09, 0x09, 0x7f, // 9
+    0x36, 0x36, // :
+    0x56, 0x36, // ;
+    0x08, 0x14, 0x22, 0x41, // <
+    0x14, 0x14, 0x14, 0x14, 0x14, // =
+    0x41, 0x22, 0x14, 0x08, // >
+    0x02, 0x01, 0x51, 0x09, 0x06, // ?
+    0x3e, 0x41, 0x5d, 0x55, 0x1e, // @
+    0x78, 0x14, 0x12, 0x11, 0x12, 0x14, 0x78, // A
+    0x7f, 0x49, 0x49, 0x49, 0x49, 0x49, 0x7f, // B
+    0x7e, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, // C
+    0x7f, 0x41, 0x41, 0x41, 0x41, 0x41, 0x7e, // D
+    0x7f, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, // E
+    0x7f, 0x09, 0x09, 0x09, 0x09, 0x01, 0x01, // F
+    0x7f, 0x41, 0x41, 0x41, 0x51, 0x51, 0x73, // G
+    0x7f, 0x08, 0x08, 0x08, 0x08, 0x08, 0x7f, // H
+    0x7f, // I
+    0x21, 0x41, 0x41, 0x3f, 0x01, 0x01, 0x01, // J
+    0x7f, 0x08, 0x08, 0x14, 0x22, 0x41, // K
+    0x7f, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, // L
+    0x7f, 0x02, 0x04, 0x08, 0x04, 0x02, 0x7f, // M
+    0x7f, 0x02, 0x04, 0x08, 0x10, 0x20, 0x7f, // N
+    0x3e, 0x41, 0x41, 0x41, 0x41, 0x41, 0x3e, // O
+    0x7f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, // P
+    0x3e, 0x41, 0x41, 0x49, 0x51, 0x61, 0x7e, // Q
+    0x7f, 0x11, 0x11, 0x11, 0x31, 0x51, 0x0e, // R
+    0x46, 0x49, 0x49, 0x49, 0x49, 0x30, // S
+    0x01, 0x01, 0x01, 0x7f, 0x01, 0x01, 0x01, // T
+    0x3f, 0x40, 0x40, 0x40, 0x40, 0x40, 0x3f, // U
+    0x0f, 0x10, 0x20, 0x40, 0x20, 0x10, 0x0f, // V
+    0x7f, 0x20, 0x10, 0x08, 0x10, 0x20, 0x7f, // W
+    0x41, 0x22, 0x14, 0x14, 0x22, 0x41, // X
+    0x01, 0x02, 0x04, 0x78, 0x04, 0x02, 0x01, // Y
+    0x41, 0x61, 0x59, 0x45, 0x43, 0x41, // Z
+    0x7f, 0x41, 0x41, // [
+    0x02, 0x04, 0x08, 0x10, 0x20, // Barra invertida
+    0x41, 0x41, 0x7f, // ]
+    0x04, 0x02, 0x01, 0x02, 0x04, // ^
+    0x40, 0x40, 0x40, 0x40, 0x40, // _
+    0x01, 0x02, 0x04, // `
+    0x20, 0x54, 0x54, 0x54, 0x78, // a
+    0x7f, 0x48, 0x44, 0x44, 0x38, // b
+    0x38, 0x44, 0x44, 0x44, 0x20, // c
+    0x38, 0x44, 0x44, 0x48, 0x7f, // d
+    0x38, 0x54, 0x54, 0x54, 0x18, // e
+    0x08, 0x7e, 0x09, 0x01, 0x02, // f
+    0x18, 0xa4, 0xa4, 0xa4, 0x7c, // g
+    0x7f, 0x08, 0x04, 0x04, 0x78, // h
+    0x44, 0x7d, 0x40, // i
+    0x40, 0x80, 0x84, 0x7d, // j
+    0x7f, 0x10, 0x28, 0x44, // k
+    0x41, 0x7f, 0x40, // l
+    0x7c, 0x04, 0x78, 0x04, 0x78, // m
+    0x7c, 0x08, 0x04, 0x04, 0x78, // n
+    0x38, 0x44, 0x44, 0x44, 0x38, // o
+    0xfc, 0x24, 0x24, 0x24, 0x18, // p
+    0x18, 0x24, 0x24, 0x24, 0xfc, // q
+    0x7c, 0x08, 0x04, 0x04, 0x08, // r
+    0x48, 0x54, 0x54, 0x54, 0x24, // s
+    0x04, 0x3f, 0x44, 0x40, 0x20, // t
+    0x3c, 0x40, 0x40, 0x20, 0x7c, // u
+    0x1c, 0x20, 0x40, 0x20, 0x1c, // v
+    0x3c, 0x40, 0x38, 0x40, 0x3c, // w
+    0x44, 0x28, 0x10, 0x28, 0x44, // x
+    0x1c, 0xa0, 0xa0, 0xa0, 0x7c, // y
+    0x44, 0x64, 0x54, 0x4c, 0x44, // z
+    0x08, 0x36, 0x41, 0x41, // {
+    0x7f, // |
+    0x41, 0x41, 0x36, 0x08, // }
+    0x08, 0x04, 0x08, 0x10, 0x08, // ~
+    0x00, 0x00, // 0xA0 NBSP
+    0x7d, // 0xA1 ¡
+    0x1c, 0x22, 0x7f, 0x22, 0x10, // 0xA2 ¢
+    0x48, 0x3e, 0x49, 0x41, 0x22, // 0xA3 £
+    0x22, 0x1c, 0x14, 0x1c, 0x22, // 0xA4 ¤
+    0x15, 0x16, 0x7c, 0x16, 0x15, // 0xA5 ¥
+    0x77, // 0xA6 ¦
+    0x0a, 0x55, 0x55, 0x55, 0x28, // 0xA7 §
+    0x01, 0x00, 0x01, // 0xA8 ¨
+    0x1c, 0x22, 0x5d, 0x55, 0x55, 0x22, 0x1c, // 0xA9 ©
+    0x48, 0x55, 0x55, 0x55, 0x5e, // 0xAA ª
+    0x08, 0x14, 0x2a, 0x14, 0x22, // 0xAB «
+    0x04, 0x04, 0x04, 0x04, 0x1c, // 0xAC ¬
+    0x08, 0x08, 0x08, 0x08, // 0xAD SHY
+    0x1c, 0x22, 0x7d, 0x55, 0x69, 0x22, 0x1c, // 0xAE ®
+    0x01, 0x01, 0x01, 0x01, 0x01, // 0xAF ¯
+    0x06, 0x09, 0x09, 0x06, // 0xB0 °
+    0x44, 0x44, 0x5f, 0x44, 0x44, // 0xB1 ±
+    0x09, 0x0d, 0x0a, // 0xB2 ²
+    0x11, 0x15, 0x0a, // 0xB3 ³
+    0x02, 0x01, // 0xB4 ´
+    0xfc, 0x20, 0x40, 0x40, 0x3c, // 0xB5 µ
+    0x06, 0x0f, 0x7f, 0x01, 0x7f, // 0xB6 ¶
+    0x08, // 0xB7 ·
+    0x80, 0xa0, 0x40, // 0xB8 ¸
+    0x0a, 0x0f, 0x08, // 0xB9 ¹
+    0x26, 0x29, 0x29, 0x29, 0x26, // 0xBA º
+    0x22, 0x14, 0x2a, 0x14, 0x08, // 0xBB »
+    0x27, 0x10, 0x28, 0x74, 0x22, // 0xBC ¼
+    0x27, 0x10, 0x08, 0x74, 0x52, // 0xBD ½
+    0x25, 0x17, 0x28, 0x74, 0x22, // 0xBE ¾
+    0x30, 0x48, 0x45, 0x40, 0x20, // 0xBF ¿
+    0x78, 0x15, 0x16, 0x14, 0x78, // 0xC0 À
+    0x78, 0x14, 0x16, 0x15, 0x78, // 0xC1 Á
+    0x78, 0x16, 0x15, 0x16, 0x78, // 0xC2 Â
+    0x7a, 0x15, 0x17, 0x16, 0x79, // 0xC3 Ã
+    0x78, 0x15, 0x14, 0x15, 0x78, // 0xC4 Ä
+    0x78, 0x16, 0x15, 0x16, 0x78, // 0xC5 Å
+    0x7e, 0x09, 0x7f, 0x49, 0x49, // 0xC6 Æ
+    0x1e, 0xa1, 0x61, 0x21, 0x12, // 0xC7 Ç
+    0x7c, 0x55, 0x56, 0x54, 0x44, // 0xC8 È
+    0x7c, 0x54, 0x56, 0x55, 0x44, // 0xC9 É
+    0x7c, 0x56, 0x55, 0x56, 0x44, // 0xCA Ê
+    0x7c, 0x55, 0x54, 0x55, 0x44, // 0xCB Ë
+    0x45, 0x7e, 0x44, // 0xCC Ì
+    0x44, 0x7e, 0x45, // 0xCD Í
+    0x46, 0x7d, 0x46, // 0xCE Î
+    0x45, 0x7c, 0x45, // 0xCF Ï
+    0x49, 0x7f, 0x49, 0x41, 0x3e, // 0xD0 Ð
+    0x7e, 0x09, 0x13, 0x22, 0x7d, // 0xD1 Ñ
+    0x38, 0x45, 0x46, 0x44, 0x38, // 0xD2 Ò
+    0x38, 0x44, 0x46, 0x45, 0x38, // 0xD3 Ó
+    0x38, 0x46, 0x45, 0x46, 0x38, // 0xD4 Ô
+    0x3a, 0x45, 0x47, 0x46, 0x39, // 0xD5 Õ
+    0x38, 0x45, 0x44, 0x45, 0x38, // 0xD6 Ö
+    0x22, 0x14, 0x08, 0x14, 0x22, // 0xD7 ×
+    0x3e, 0x61, 0x5d, 0x43, 0x3e, // 0xD8 Ø
+    0x3c, 0x41, 0x42, 0x40, 0x3c, // 0xD9 Ù
+    0x3c, 0x40, 0x42, 0x41, 0x3c, // 0xDA Ú
+    0x3c, 0x42, 0x41, 0x42, 0x3c, // 0xDB Û
+    0x3c, 0x41, 0x40, 0x41, 0x3c, // 0xDC Ü
+    0x04, 0x08, 0x72, 0x09, 0x04, // 0xDD Ý
+    0x7f, 0x12, 0x12, 0x12, 0x0c, // 0xDE Þ
+    0x7e, 0x01, 0x49, 0x56, 0x20, // 0xDF ß
+    0x20, 0x55, 0x56, 0x54, 0x78, // 0xE0 à
+    0x20, 0x54, 0x56, 0x55, 0x78, // 0xE1 á
+    0x20, 0x56, 0x55, 0x56, 0x78, // 0xE2 â
+    0x22, 0x55, 0x57, 0x56, 0x79, // 0xE3 ã
+    0x20, 0x55, 0x54, 0x55, 0x78, // 0xE4 ä
+    0x20, 0x56, 0x55, 0x56, 0x78, // 0xE5 å
+    0x24, 0x54, 0x38, 0x54, 0x58, // 0xE6 æ
+    0x38, 0x44, 0xc4, 0x44, 0x20, // 0xE7 ç
+    0x38, 0x55, 0x56, 0x54, 0x18, // 0xE8 è
+    0x38, 0x54, 0x56, 0x55, 0x18, // 0xE9 é
+    0x38, 0x56, 0x55, 0x56, 0x18, // 0xEA ê
+    0x38, 0x55, 0x54, 0x55, 0x18, // 0xEB ë
+    0x45, 0x7e, 0x40, // 0xEC ì
+    0x44, 0x7e, 0x41, // 0xED í
+    0x46, 0x7d, 0x42, // 0xEE î
+    0x45, 0x7c, 0x41, // 0xEF ï
+    0x20, 0x55, 0x52, 0x55, 0x38, // 0xF0 ð
+    0x7e, 0x09, 0x07, 0x06, 0x79, // 0xF1 ñ
+    0x38, 0x45, 0x46, 0x44, 0x38, // 0xF2 ò
+    0x38, 0x44, 0x46, 0x45, 0x38, // 0xF3 ó
+    0x38, 0x46, 0x45, 0x46, 0x38, // 0xF4 ô
+    0x3a, 0x45, 0x47, 0x46, 0x39, // 0xF5 õ
+    0x38, 0x45, 0x44, 0x45, 0x38, // 0xF6 ö
+    0x08, 0x08, 0x2a, 0x08, 0x08, // 0xF7 ÷
+    0x38, 0x64, 0x54, 0x4c, 0x38, // 0xF8 ø
+    0x3c, 0x41, 0x42, 0x20, 0x7c, // 0xF9 ù
+    0x3c, 0x40, 0x42, 0x21, 0x7c, // 0xFA ú
+    0x3c, 0x42, 0x41, 0x22, 0x7c, // 0xFB û
+    0x3c, 0x41, 0x40, 0x21, 0x7c, // 0xFC ü
+    0x1c, 0xa0, 0xa2, 0xa1, 0x7c, // 0xFD ý
+    0xff, 0x24, 0x24, 0x24, 0x18, // 0xFE þ
+    0x1c, 0xa1, 0xa0, 0xa1, 0x7c, // 0xFF ÿ
+};
+
+static const uint16_t font_prop_offsets[] = {
+    0, 2, 3, 6, 11, 16, 21, 26, 28, 31, 34, 39, 44, 46, 51, 53,
+    58, 65, 68, 74, 81, 87, 93, 100, 107, 114, 121, 123, 125, 129, 134, 138,
+    143, 148, 155, 162, 169, 176, 183, 190, 197, 204, 205, 212, 218, 225, 232, 239,
+    246, 253, 260, 267, 273, 280, 287, 294, 301, 307, 314, 320, 323, 328, 331, 336,
+    341, 344, 349, 354, 359, 364, 369, 374, 379, 384, 387, 391, 395, 398, 403, 408,
+    413, 418, 423, 428, 433, 438, 443, 448, 453, 458, 463, 468, 472, 473, 477, 482,
+    482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482,
+    482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482,
+    482, 484, 485, 490, 495, 500, 505, 506, 511, 514, 521, 526, 531, 536, 540, 547,
+    552, 556, 561, 564, 567, 569, 574, 579, 580, 583, 586, 591, 596, 601, 606, 611,
+    616, 621, 626, 631, 636, 641, 646, 651, 656, 661, 666, 671, 676, 679, 682, 685,
+    688, 693, 698, 703, 708, 713, 718, 723, 728, 733, 738, 743, 748, 753, 758, 763,
+    768, 773, 778, 783, 788, 793, 798, 803, 808, 813, 818, 823, 828, 831, 834, 837,
+    840, 845, 850, 855, 860, 865, 870, 875, 880, 885, 890, 895, 900, 905, 910, 915,
+};
+
+static const uint8_t font_prop_widths[] = {
+    2, 1, 3, 5, 5, 5, 5, 2, 3, 3, 5, 5, 2, 5, 2, 5,
+    7, 3, 6, 7, 6, 6, 7, 7, 7, 7, 2, 2, 4, 5, 4, 5,
+    5, 7, 7, 7, 7, 7, 7, 7, 7, 1, 7, 6, 7, 7, 7, 7,
+    7, 7, 7, 6, 7, 7, 7, 7, 6, 7, 6, 3, 5, 3, 5, 5,
+    3, 5, 5, 5, 5, 5, 5, 5, 5, 3, 4, 4, 3, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 4, 1, 4, 5, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 1, 5, 5, 5, 5, 1, 5, 3, 7, 5, 5, 5, 4, 7, 5,
+    4, 5, 3, 3, 2, 5, 5, 1, 3, 3, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 3, 3, 3, 3,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 3, 3, 3, 3,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+};
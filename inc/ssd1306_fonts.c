@@ -0,0 +1,10 @@
+#include "pico/stdlib.h"
+#include "hardware/i2c.h"
+#include "ssd1306_i2c.h"
+#include "ssd1306.h"
+
+// Fontes geradas no build por tools/font_compiler a partir de fonts/*.bdf (ver CMakeLists.txt)
+// As tabelas são const e ficam na flash; cada uma define o ssd1306_font_t de mesmo nome
+#include "fonts/ssd1306_font_5x7.h"   // Texto pequeno: 5 colunas + 1 de espaço (21 caracteres por linha)
+#include "fonts/ssd1306_font_12x16.h" // Leituras numéricas: duas páginas, algarismos de largura fixa
+#include "fonts/ssd1306_font_16x24.h" // Leituras numéricas grandes: três páginas
@@ -5,37 +5,143 @@
 #include "pico/stdlib.h"
 #include "pico/binary_info.h"
 #include "hardware/i2c.h"
-#include "ssd1306_font.h"
 #include "ssd1306_i2c.h"
+#include "ssd1306.h"
 
-// Calcular quanto do buffer será destinado à área de renderização
-void calculate_render_area_buffer_length(struct render_area *area) {
-    area->buffer_length = (area->end_column - area->start_column + 1) * (area->end_page - area->start_page + 1);
+// Escrita bloqueante num barramento e endereço; antes aguarda o fim de um envio assíncrono em andamento
+// Toda escrita bloqueante do driver passa por aqui, para não intercalar bytes com um DMA no mesmo barramento
+static void ssd1306_write_blocking_to(i2c_inst_t *i2c, uint8_t address, const uint8_t *buffer, size_t length) {
+    ssd1306_async_wait();
+    i2c_write_blocking(i2c, address, buffer, length, false);
+}
+
+// Escrita bloqueante no barramento do display
+static void ssd1306_write_blocking(const uint8_t *buffer, size_t length) {
+    ssd1306_write_blocking_to(i2c1, ssd1306_i2c_address, buffer, length);
+}
+
+// Prepara um construtor de comandos vazio para o display no barramento e endereço informados
+void ssd1306_command_builder_init(ssd1306_command_builder_t *builder, i2c_inst_t *i2c, uint8_t address) {
+    builder->i2c = i2c;
+    builder->address = address;
+    builder->buffer[0] = 0x00;
+    builder->length = 1;
+    builder->command_count = 0;
+    builder->has_data = false;
+}
+
+// Envia numa única transação o que foi acumulado e esvazia o construtor
+void ssd1306_command_builder_flush(ssd1306_command_builder_t *builder) {
+    if (builder->length > 1) {
+        ssd1306_write_blocking_to(builder->i2c, builder->address, builder->buffer, builder->length);
+    }
+    ssd1306_command_builder_init(builder, builder->i2c, builder->address);
+}
+
+// Acrescenta um comando (ou parâmetro de comando)
+void ssd1306_command_builder_add(ssd1306_command_builder_t *builder, uint8_t command) {
+    // Depois de 0x40 tudo é interpretado como dado: o comando vai na próxima transação
+    if (builder->has_data || builder->length == ssd1306_command_builder_size) {
+        ssd1306_command_builder_flush(builder);
+    }
+
+    builder->buffer[builder->length++] = command;
+    builder->command_count++;
+}
+
+// Acrescenta uma lista de comandos
+void ssd1306_command_builder_add_list(ssd1306_command_builder_t *builder, const uint8_t *commands, int number) {
+    for (int i = 0; i < number; i++) {
+        ssd1306_command_builder_add(builder, commands[i]);
+    }
+}
+
+// Acrescenta dados (GDDRAM) após os comandos; se não couberem, continuam em transações seguintes
+void ssd1306_command_builder_add_data(ssd1306_command_builder_t *builder, const uint8_t *data, int length) {
+    while (length > 0) {
+        if (!builder->has_data) {
+            // Os comandos passam a ter um byte de controle cada (Co = 1), seguidos de 0x40 (Co = 0, D/C = 1)
+            if (2 * builder->command_count + 2 > ssd1306_command_builder_size) {
+                ssd1306_command_builder_flush(builder);
+            }
+
+            int count = builder->command_count;
+            for (int i = count - 1; i >= 0; i--) {
+                builder->buffer[2 * i + 1] = builder->buffer[i + 1];
+                builder->buffer[2 * i] = 0x80;
+            }
+            builder->buffer[2 * count] = 0x40;
+            builder->length = 2 * count + 1;
+            builder->has_data = true;
+        }
+
+        int chunk = ssd1306_command_builder_size - builder->length;
+        if (chunk > length) {
+            chunk = length;
+        }
+
+        memcpy(builder->buffer + builder->length, data, chunk);
+        builder->length += chunk;
+        data += chunk;
+        length -= chunk;
+
+        if (builder->length == ssd1306_command_builder_size) {
+            ssd1306_command_builder_flush(builder);
+        }
+    }
 }
 
 // Processo de escrita do i2c espera um byte de controle, seguido por dados
 void ssd1306_send_command(uint8_t command) {
     uint8_t buffer[2] = {0x80, command};
-    i2c_write_blocking(i2c1, ssd1306_i2c_address, buffer, 2, false);
+    ssd1306_write_blocking(buffer, 2);
 }
 
-// Envia uma lista de comandos ao hardware
+// Envia uma lista de comandos ao hardware numa única transação (um só byte de controle 0x00)
 void ssd1306_send_command_list(uint8_t *ssd, int number) {
-    for (int i = 0; i < number; i++) {
-        ssd1306_send_command(ssd[i]);
-    }
+    ssd1306_command_builder_t builder;
+
+    ssd1306_command_builder_init(&builder, i2c1, ssd1306_i2c_address);
+    ssd1306_command_builder_add_list(&builder, ssd, number);
+    ssd1306_command_builder_flush(&builder);
 }
 
-// Copia buffer de referência num novo buffer, a fim de adicionar o byte de controle desde o início
-void ssd1306_send_buffer(uint8_t ssd[], int buffer_length) {
-    uint8_t *temp_buffer = malloc(buffer_length + 1);
+// Envia dados de um buffer sem byte livre antes dele: cada transação leva o byte de controle e até
+// ssd1306_send_chunk_size bytes, copiados num buffer da pilha (o display continua a escrita de onde parou).
+// Retorna false, sem enviar nada, se buffer_length passar do tamanho do quadro.
+// Para enviar sem cópia e numa só transação, use ssd1306_framebuffer_t (ver ssd1306_send_buffer_in_place)
+bool ssd1306_send_buffer(uint8_t ssd[], int buffer_length) {
+    uint8_t chunk[ssd1306_send_chunk_size + 1];
 
-    temp_buffer[0] = 0x40;
-    memcpy(temp_buffer + 1, ssd, buffer_length);
+    if (buffer_length < 0 || buffer_length > ssd1306_buffer_length) {
+        return false;
+    }
 
-    i2c_write_blocking(i2c1, ssd1306_i2c_address, temp_buffer, buffer_length + 1, false);
+    chunk[0] = 0x40;
+    for (int sent = 0; sent < buffer_length; sent += ssd1306_send_chunk_size) {
+        int length = buffer_length - sent < ssd1306_send_chunk_size ? buffer_length - sent : ssd1306_send_chunk_size;
 
-    free(temp_buffer);
+        memcpy(chunk + 1, ssd + sent, length);
+        ssd1306_write_blocking(chunk, length + 1);
+    }
+    return true;
+}
+
+// Envia dados sem cópia, usando temporariamente o byte anterior a "data" como byte de controle
+// O byte anterior precisa pertencer ao mesmo buffer (ex.: o campo control de ssd1306_framebuffer_t)
+static void ssd1306_send_buffer_in_place(uint8_t *data, int buffer_length) {
+    uint8_t saved = data[-1];
+
+    data[-1] = 0x40;
+    ssd1306_write_blocking(data - 1, buffer_length + 1);
+    data[-1] = saved;
+}
+
+// Prepara um framebuffer zerado, com o byte de controle já posicionado antes dos pixels e sem faixas sujas
+void ssd1306_framebuffer_init(ssd1306_framebuffer_t *fb) {
+    fb->control = 0x40;
+    memset(fb->data, 0, ssd1306_buffer_length);
+    memset(&fb->dirty, 0, sizeof(fb->dirty));
 }
 
 // Cria a lista de comandos (com base nos endereços definidos em ssd1306_i2c.h) para a inicialização do display
@@ -74,140 +180,115 @@ void ssd1306_scroll(bool set) {
     ssd1306_send_command_list(commands, count_of(commands));
 }
 
-// Atualiza uma parte do display com uma área de renderização
-void render_on_display(uint8_t *ssd, struct render_area *area) {
+// Define a janela de endereços (colunas e páginas) que receberá os próximos dados
+static void ssd1306_set_render_window(struct render_area *area) {
     uint8_t commands[] = {
         ssd1306_set_column_address, area->start_column, area->end_column,
         ssd1306_set_page_address, area->start_page, area->end_page
     };
 
     ssd1306_send_command_list(commands, count_of(commands));
-    ssd1306_send_buffer(ssd, area->buffer_length);
 }
 
-// Determina o pixel a ser aceso (no display) de acordo com a coordenada fornecida
-void ssd1306_set_pixel(uint8_t *ssd, int x, int y, bool set) {
-    assert(x >= 0 && x < ssd1306_width && y >= 0 && y < ssd1306_height);
-
-    const int bytes_per_row = ssd1306_width;
-
-    int byte_idx = (y / 8) * bytes_per_row + x;
-    uint8_t byte = ssd[byte_idx];
+// Atualiza uma parte do display com uma área de renderização
+void render_on_display(uint8_t *ssd, struct render_area *area) {
+    ssd1306_set_render_window(area);
+    ssd1306_send_buffer(ssd, area->buffer_length);
+}
 
-    if (set) {
-        byte |= 1 << (y % 8);
+// Atualiza uma parte do display diretamente a partir do framebuffer, sem cópia
+// Aqui a área é uma janela dentro do quadro inteiro (e não um buffer já recortado)
+void render_framebuffer_on_display(ssd1306_framebuffer_t *fb, struct render_area *area) {
+    if (area->start_column == 0 && area->end_column == ssd1306_width - 1) {
+        // Páginas inteiras são contíguas no framebuffer: uma única transferência
+        ssd1306_set_render_window(area);
+        if (area->start_page == 0) {
+            ssd1306_write_blocking(&fb->control, area->buffer_length + 1);
+        }
+        else {
+            ssd1306_send_buffer_in_place(fb->data + area->start_page * ssd1306_width, area->buffer_length);
+        }
     }
     else {
-        byte &= ~(1 << (y % 8));
+        // Janela parcial: uma transferência por página
+        for (int page = area->start_page; page <= area->end_page; page++) {
+            struct render_area row = {
+                .start_column = area->start_column,
+                .end_column = area->end_column,
+                .start_page = page,
+                .end_page = page
+            };
+            calculate_render_area_buffer_length(&row);
+
+            ssd1306_set_render_window(&row);
+            ssd1306_send_buffer_in_place(fb->data + page * ssd1306_width + row.start_column, row.buffer_length);
+        }
     }
 
-    ssd[byte_idx] = byte;
+    ssd1306_mark_area_clean(&fb->dirty, area);
 }
 
-// Algoritmo de Bresenham básico
-void ssd1306_draw_line(uint8_t *ssd, int x_0, int y_0, int x_1, int y_1, bool set) {
-    int dx = abs(x_1 - x_0); // Deslocamentos
-    int dy = -abs(y_1 - y_0);
-    int sx = x_0 < x_1 ? 1 : -1; // Direção de avanço
-    int sy = y_0 < y_1 ? 1 : -1;
-    int error = dx + dy; // Erro acumulado
-    int error_2;
-
-    while (true) {
-        ssd1306_set_pixel(ssd, x_0, y_0, set); // Acende pixel no ponto atual
-        if (x_0 == x_1 && y_0 == y_1) {
-            break; // Verifica se o ponto final foi alcançado
+// Envia somente as colunas alteradas de cada página, com uma janela de endereço por página
+static void ssd1306_render_dirty(uint8_t *ssd, ssd1306_dirty_t *dirty, bool in_place) {
+    for (int page = 0; page < ssd1306_n_pages; page++) {
+        struct render_area area;
+        if (!ssd1306_take_dirty_area(dirty, page, &area)) {
+            continue;
         }
 
-        error_2 = 2 * error; // Ajusta o erro acumulado
+        uint8_t *span = ssd + page * ssd1306_width + area.start_column;
 
-        if (error_2 >= dy) {
-            error += dy;
-            x_0 += sx; // Avança na direção x
+        ssd1306_set_render_window(&area);
+        if (in_place) {
+            ssd1306_send_buffer_in_place(span, area.buffer_length);
         }
-        if (error_2 <= dx) {
-            error += dx;
-            y_0 += sy; // Avança na direção y
+        else {
+            ssd1306_send_buffer(span, area.buffer_length);
         }
     }
 }
 
-// Adquire os pixels para um caractere (de acordo com ssd1306_font.h)
-inline int ssd1306_get_font(uint8_t character)
-{
-  if (character >= 'A' && character <= 'Z') {
-    return character - 'A' + 1;
-  }
-  else if (character >= '0' && character <= '9') {
-    return character - '0' + 27;
-  }
-  else
-    return 0;
+// Envia ao display somente as colunas de ssd marcadas em dirty (ex.: desenhadas por um contexto com ctx->dirty)
+void render_dirty_on_display(uint8_t *ssd, ssd1306_dirty_t *dirty) {
+    ssd1306_render_dirty(ssd, dirty, false);
 }
 
-// Desenha um único caractere no display
-void ssd1306_draw_char(uint8_t *ssd, int16_t x, int16_t y, uint8_t character) {
-    if (x > ssd1306_width - 8 || y > ssd1306_height - 8) {
-        return;
-    }
-
-    y = y / 8;
-
-    character = toupper(character);
-    int idx = ssd1306_get_font(character);
-    int fb_idx = y * 128 + x;
-
-    for (int i = 0; i < 8; i++) {
-        ssd[fb_idx++] = font[idx * 8 + i];
-    }
-}
-
-// Desenha uma string, chamando a função de desenhar caractere várias vezes
-void ssd1306_draw_string(uint8_t *ssd, int16_t x, int16_t y, char *string) {
-    if (x > ssd1306_width - 8 || y > ssd1306_height - 8) {
-        return;
-    }
-
-    while (*string) {
-        ssd1306_draw_char(ssd, x, y, *string++);
-        x += 8;
-    }
+// Envia ao display somente as colunas alteradas de cada página, direto do framebuffer (sem cópia)
+void render_framebuffer_dirty_on_display(ssd1306_framebuffer_t *fb) {
+    ssd1306_render_dirty(fb->data, &fb->dirty, true);
 }
 
 // Comando de configuração com base na estrutura ssd1306_t
 void ssd1306_command(ssd1306_t *ssd, uint8_t command) {
   ssd->port_buffer[1] = command;
-  i2c_write_blocking(
-	ssd->i2c_port, ssd->address, ssd->port_buffer, 2, false );
+  ssd1306_write_blocking_to(ssd->i2c_port, ssd->address, ssd->port_buffer, 2);
 }
 
 // Função de configuração do display para o caso do bitmap
 void ssd1306_config(ssd1306_t *ssd) {
-    ssd1306_command(ssd, ssd1306_set_display | 0x00);
-    ssd1306_command(ssd, ssd1306_set_memory_mode);
-    ssd1306_command(ssd, 0x01);
-    ssd1306_command(ssd, ssd1306_set_display_start_line | 0x00);
-    ssd1306_command(ssd, ssd1306_set_segment_remap | 0x01);
-    ssd1306_command(ssd, ssd1306_set_mux_ratio);
-    ssd1306_command(ssd, ssd1306_height - 1);
-    ssd1306_command(ssd, ssd1306_set_common_output_direction | 0x08);
-    ssd1306_command(ssd, ssd1306_set_display_offset);
-    ssd1306_command(ssd, 0x00);
-    ssd1306_command(ssd, ssd1306_set_common_pin_configuration);
-    ssd1306_command(ssd, 0x12);
-    ssd1306_command(ssd, ssd1306_set_display_clock_divide_ratio);
-    ssd1306_command(ssd, 0x80);
-    ssd1306_command(ssd, ssd1306_set_precharge);
-    ssd1306_command(ssd, 0xF1);
-    ssd1306_command(ssd, ssd1306_set_vcomh_deselect_level);
-    ssd1306_command(ssd, 0x30);
-    ssd1306_command(ssd, ssd1306_set_contrast);
-    ssd1306_command(ssd, 0xFF);
-    ssd1306_command(ssd, ssd1306_set_entire_on);
-    ssd1306_command(ssd, ssd1306_set_normal_display);
-    ssd1306_command(ssd, ssd1306_set_charge_pump);
-    ssd1306_command(ssd, 0x14);
-    ssd1306_command(ssd, ssd1306_set_display | 0x01);
+    uint8_t commands[] = {
+        ssd1306_set_display | 0x00,
+        ssd1306_set_memory_mode, 0x01,
+        ssd1306_set_display_start_line | 0x00,
+        ssd1306_set_segment_remap | 0x01,
+        ssd1306_set_mux_ratio, ssd1306_height - 1,
+        ssd1306_set_common_output_direction | 0x08,
+        ssd1306_set_display_offset, 0x00,
+        ssd1306_set_common_pin_configuration, 0x12,
+        ssd1306_set_display_clock_divide_ratio, 0x80,
+        ssd1306_set_precharge, 0xF1,
+        ssd1306_set_vcomh_deselect_level, 0x30,
+        ssd1306_set_contrast, 0xFF,
+        ssd1306_set_entire_on,
+        ssd1306_set_normal_display,
+        ssd1306_set_charge_pump, 0x14,
+        ssd1306_set_display | 0x01,
+    };
+    ssd1306_command_builder_t builder;
+
+    ssd1306_command_builder_init(&builder, ssd->i2c_port, ssd->address);
+    ssd1306_command_builder_add_list(&builder, commands, count_of(commands));
+    ssd1306_command_builder_flush(&builder);
 }
 
 // Inicializa o display para o caso de exibição de bitmap
@@ -225,21 +306,65 @@ void ssd1306_init_bm(ssd1306_t *ssd, uint8_t width, uint8_t height, bool externa
 
 // Envia os dados ao display
 void ssd1306_send_data(ssd1306_t *ssd) {
-    ssd1306_command(ssd, ssd1306_set_column_address);
-    ssd1306_command(ssd, 0);
-    ssd1306_command(ssd, ssd->width - 1);
-    ssd1306_command(ssd, ssd1306_set_page_address);
-    ssd1306_command(ssd, 0);
-    ssd1306_command(ssd, ssd->pages - 1);
-    i2c_write_blocking(
-    ssd->i2c_port, ssd->address, ssd->ram_buffer, ssd->bufsize, false );
+    uint8_t commands[] = {
+        ssd1306_set_column_address, 0, ssd->width - 1,
+        ssd1306_set_page_address, 0, ssd->pages - 1
+    };
+    ssd1306_command_builder_t builder;
+
+    ssd1306_command_builder_init(&builder, ssd->i2c_port, ssd->address);
+    ssd1306_command_builder_add_list(&builder, commands, count_of(commands));
+    ssd1306_command_builder_flush(&builder);
+
+    ssd1306_write_blocking_to(ssd->i2c_port, ssd->address, ssd->ram_buffer, ssd->bufsize);
 }
 
 // Desenha o bitmap (a ser fornecido em display_oled.c) no display
+// A imagem é copiada de uma só vez para o buffer e enviada numa única transferência
 void ssd1306_draw_bitmap(ssd1306_t *ssd, const uint8_t *bitmap) {
-    for (int i = 0; i < ssd->bufsize - 1; i++) {
-        ssd->ram_buffer[i + 1] = bitmap[i];
+    memcpy(ssd->ram_buffer + 1, bitmap, ssd->bufsize - 1);
+    ssd1306_send_data(ssd);
+}
+
+// Copia um bitmap parcial (width x height pixels) para o buffer, com o canto superior esquerdo em (x, y)
+// O bitmap segue o formato do display: para cada coluna, (height + 7) / 8 bytes verticais (bit 0 = pixel de cima)
+// A parte que ficar fora da tela é recortada; nada é enviado ao display
+void ssd1306_blit_bitmap(ssd1306_t *ssd, const uint8_t *bitmap, int x, int y, int width, int height) {
+    int src_pages = (height + 7) / 8;
 
-        ssd1306_send_data(ssd);
+    for (int col = 0; col < width; col++) {
+        int dst_x = x + col;
+        if (dst_x < 0 || dst_x >= ssd->width) {
+            continue;
+        }
+
+        uint8_t *dst = ssd->ram_buffer + 1 + dst_x * ssd->pages;
+        const uint8_t *src = bitmap + col * src_pages;
+
+        for (int page = 0; page < src_pages; page++) {
+            int rows = height - page * 8;
+            uint8_t mask = rows >= 8 ? 0xFF : (uint8_t)((1u << rows) - 1);
+
+            // Página de destino (arredondada para baixo, mesmo com y negativo) e deslocamento dentro dela
+            int dst_y = y + page * 8;
+            int dst_page = dst_y >= 0 ? dst_y / 8 : -((7 - dst_y) / 8);
+            int shift = dst_y - dst_page * 8;
+
+            uint16_t bits = (uint16_t)((src[page] & mask) << shift);
+            uint16_t bits_mask = (uint16_t)(mask << shift);
+
+            if (dst_page >= 0 && dst_page < ssd->pages) {
+                dst[dst_page] = (dst[dst_page] & ~bits_mask) | (uint8_t)bits;
+            }
+            if (shift && dst_page + 1 >= 0 && dst_page + 1 < ssd->pages) {
+                dst[dst_page + 1] = (dst[dst_page + 1] & ~(bits_mask >> 8)) | (uint8_t)(bits >> 8);
+            }
+        }
     }
 }
+
+// Desenha um bitmap parcial em qualquer posição e atualiza o display numa única transferência
+void ssd1306_draw_bitmap_partial(ssd1306_t *ssd, const uint8_t *bitmap, int x, int y, int width, int height) {
+    ssd1306_blit_bitmap(ssd, bitmap, x, y, width, height);
+    ssd1306_send_data(ssd);
+}
@@ -47,6 +47,112 @@
 #define ssd1306_write_mode _u(0xFE)
 #define ssd1306_read_mode _u(0xFF)
 
+#define ssd1306_command_builder_size 64 // Bytes por transação do construtor de comandos (inclui o byte de controle)
+#define ssd1306_send_chunk_size ssd1306_width // Dados por transação de ssd1306_send_buffer (uma página inteira)
+#define ssd1306_diff_merge_gap 8 // Trechos alterados separados por até 8 bytes iguais são enviados juntos (mais barato que outra janela)
+#define ssd1306_max_diff_areas (ssd1306_n_pages * (ssd1306_width / (ssd1306_diff_merge_gap + 1) + 1))
+
+// Modo de combinação dos pixels desenhados com o que já está no framebuffer
+typedef enum {
+    ssd1306_draw_opaque,  // Substitui (pixels apagados do glifo apagam o fundo)
+    ssd1306_draw_or,      // Acende os pixels do glifo, mantendo o fundo
+    ssd1306_draw_and_not, // Apaga os pixels do glifo
+    ssd1306_draw_xor,     // Inverte os pixels do glifo
+} ssd1306_draw_mode_t;
+
+// Retângulo de recorte, em pixels (limites inclusivos; vazio quando x_1 < x_0 ou y_1 < y_0)
+typedef struct {
+    int16_t x_0, y_0;
+    int16_t x_1, y_1;
+} ssd1306_clip_t;
+
+#define ssd1306_clip_stack_depth 8 // Recortes aninhados (tela, janela, widget, ...)
+
+// Faixa de colunas alteradas (suja) em cada página de um buffer, desde o último envio
+typedef struct {
+    struct {
+        bool is_dirty;
+        uint8_t min_column;
+        uint8_t max_column;
+    } pages[ssd1306_n_pages];
+} ssd1306_dirty_t;
+
+// Contexto de desenho (ssd1306_ctx_*): framebuffer, faixas sujas dele (ou NULL) e pilha de recortes;
+// clip[depth] é o recorte atual. Cada primitiva recorta uma vez contra ele e só então entra no laço
+// interno, que não confere limites
+typedef struct {
+    uint8_t *ssd;
+    ssd1306_dirty_t *dirty;
+    uint8_t depth;
+    ssd1306_clip_t clip[ssd1306_clip_stack_depth];
+} ssd1306_context_t;
+
+// Fonte para o desenho de texto com largura por glifo (ssd1306_draw_string_font)
+// - data: colunas dos glifos empacotadas; com altura > 8 cada glifo tem (height + 7) / 8 linhas de página
+//   de "largura" bytes, no mesmo formato aceito por ssd1306_draw_glyph
+// - offsets/widths: início e largura de cada glifo, indexados por (caractere - first_char)
+// - widths NULL indica fonte de largura fixa (fixed_width colunas; offsets também pode ser NULL)
+typedef struct {
+    const uint8_t *data;
+    const uint16_t *offsets;
+    const uint8_t *widths;
+    uint8_t first_char;
+    uint8_t last_char;
+    uint8_t height;      // Altura em pixels
+    uint8_t fixed_width; // Largura de todos os glifos quando widths é NULL
+    uint8_t spacing;     // Colunas vazias acrescentadas após cada glifo
+} ssd1306_font_t;
+
+// Quebra de um texto em linhas (ssd1306_text_lines_next): guarda só onde o texto continua
+typedef struct {
+    const char *text;
+    const ssd1306_font_t *font;
+    int width; // Largura disponível para cada linha, em pixels
+} ssd1306_text_lines_t;
+
+// Alinhamento horizontal das linhas de um ssd1306_layout_t dentro da sua caixa
+typedef enum {
+    ssd1306_align_left,
+    ssd1306_align_center,
+    ssd1306_align_right,
+} ssd1306_align_t;
+
+#define ssd1306_layout_max_lines (ssd1306_height / 8) // Linhas que cabem na tela com a fonte de 8 pixels
+
+// Linha já diagramada: trecho do texto original, posição alinhada e se leva reticências
+typedef struct {
+    const char *start;
+    uint16_t length;  // Bytes de start que são desenhados (sem as reticências)
+    int16_t x;        // Posição do primeiro glifo, já alinhada
+    bool ellipsis;    // Desenha "..." logo depois do trecho (o texto não coube)
+    uint32_t hash;    // Conteúdo da linha quando definida por ssd1306_layout_set_line
+} ssd1306_layout_line_t;
+
+// Bloco de texto diagramado numa caixa: as quebras de linha, o alinhamento e as reticências são calculados
+// uma vez (ssd1306_layout_set_text / ssd1306_layout_set_line) e reaproveitados em cada ssd1306_layout_draw
+typedef struct {
+    const ssd1306_font_t *font;
+    int16_t x, y, width, height; // Caixa, em pixels
+    ssd1306_align_t align;
+    bool wrap;                   // Quebra linhas longas no último espaço; sem wrap, elas terminam em "..."
+    uint32_t text_hash;
+    uint8_t line_count;
+    ssd1306_layout_line_t lines[ssd1306_layout_max_lines];
+} ssd1306_layout_t;
+
+#define ssd1306_field_max_cells 12 // Sinal, 10 algarismos e o ponto decimal de um int32_t
+
+// Campo numérico (ssd1306_number_field_set): células de largura fixa e o caractere já desenhado em cada uma
+typedef struct {
+    const ssd1306_font_t *font;
+    int16_t x, y;        // Canto superior esquerdo da primeira célula
+    uint8_t cells;       // Quantidade de células (o número fica alinhado à direita)
+    uint8_t cell_width;  // Largura de cada célula, em pixels
+    uint8_t decimals;    // Casas decimais do valor em ponto fixo
+    bool valid;          // drawn corresponde ao que está no framebuffer
+    char drawn[ssd1306_field_max_cells];
+} ssd1306_number_field_t;
+
 struct render_area {
     uint8_t start_column;
     uint8_t end_column;
@@ -56,6 +162,57 @@ struct render_area {
     int buffer_length;
 };
 
+// Framebuffer com o byte de controle (0x40) reservado logo antes dos pixels, como em ssd1306_t::ram_buffer,
+// para que o quadro seja enviado ao display sem cópia e sem alocação.
+// As funções que recebem "uint8_t *ssd" continuam funcionando sobre o campo data.
+typedef struct {
+    uint8_t control;
+    uint8_t data[ssd1306_buffer_length];
+    ssd1306_dirty_t dirty; // Faixas sujas de data (marcadas pelas funções que recebem o framebuffer ou um contexto dele)
+} ssd1306_framebuffer_t;
+
+// Construtor de comandos: acumula comandos (e, opcionalmente, dados) para enviá-los numa única transação I2C
+// - só comandos: 0x00 (Co = 0) seguido de todos os comandos
+// - comandos + dados: cada comando precedido de 0x80 (Co = 1) e, por fim, 0x40 seguido dos dados
+typedef struct {
+    i2c_inst_t *i2c;
+    uint8_t address;
+    uint8_t buffer[ssd1306_command_builder_size];
+    int length;
+    int command_count;
+    bool has_data;
+} ssd1306_command_builder_t;
+
+// Envio assíncrono: função chamada quando o quadro inteiro foi entregue ao controlador I2C
+typedef void (*ssd1306_async_callback_t)(void *user_data);
+
+// Transporte usado pelo envio assíncrono (DMA no RP2040, ou um simulado para testes no computador):
+// - start: inicia a escrita de "count" palavras no formato do registrador IC_DATA_CMD
+//   (byte nos bits 0-7, bit de STOP no último byte de cada transação) e retorna imediatamente;
+//   ao terminar, o transporte chama ssd1306_async_transfer_complete()
+// - wait_idle: aguarda o barramento esvaziar (pode ser NULL)
+typedef struct {
+    void (*start)(const uint16_t *words, size_t count);
+    void (*wait_idle)(void);
+} ssd1306_transport_t;
+
+// Par de framebuffers: a aplicação desenha livremente em back; front guarda o que já está no display.
+// ssd1306_present envia só os trechos em que back difere de front e então os iguala.
+typedef struct {
+    ssd1306_framebuffer_t back;
+    uint8_t front[ssd1306_buffer_length];
+} ssd1306_double_buffer_t;
+
+// Estatística de latência (ex.: do aperto do botão até o quadro terminar de chegar ao display), em microssegundos
+// Gravada numa interrupção ou no core1: leia com ssd1306_latency_read (sequence ímpar = gravação em andamento)
+typedef struct {
+    volatile uint32_t sequence;
+    volatile uint32_t frames;
+    volatile uint32_t last_us;
+    volatile uint32_t max_us;
+    volatile uint64_t total_us;
+} ssd1306_latency_t;
+
 typedef struct {
   uint8_t width, height, pages, address;
   i2c_inst_t * i2c_port;
@@ -0,0 +1,46 @@
+#include "pico/stdlib.h"
+#include "hardware/sync.h"
+#include "ssd1306_i2c.h"
+#include "ssd1306.h"
+
+// Estatística de latência dos quadros, usada pelo envio por DMA e pelo modo pipeline.
+// Quem grava (interrupção do DMA ou core1) é um só; quem lê (laço principal do core0) pode ser interrompido
+// no meio da leitura, e total_us tem 64 bits. Por isso a gravação fica entre dois incrementos de sequence
+// (ímpar durante a gravação) e a leitura repete enquanto a sequência estiver ímpar ou mudar.
+
+// Acumula a latência de um quadro que acabou de chegar ao display
+void ssd1306_latency_record(ssd1306_latency_t *stats, uint32_t start_us) {
+    uint32_t elapsed = time_us_32() - start_us;
+
+    stats->sequence++;
+    __dmb();
+
+    stats->last_us = elapsed;
+    if (elapsed > stats->max_us) {
+        stats->max_us = elapsed;
+    }
+    stats->total_us += elapsed;
+    stats->frames++;
+
+    __dmb();
+    stats->sequence++;
+}
+
+// Copia a estatística para snapshot com todos os campos do mesmo instante (sem uma gravação pela metade)
+void ssd1306_latency_read(const ssd1306_latency_t *stats, ssd1306_latency_t *snapshot) {
+    uint32_t sequence;
+
+    do {
+        sequence = stats->sequence;
+        __dmb();
+
+        snapshot->frames = stats->frames;
+        snapshot->last_us = stats->last_us;
+        snapshot->max_us = stats->max_us;
+        snapshot->total_us = stats->total_us;
+
+        __dmb();
+    } while ((sequence & 1) || sequence != stats->sequence);
+
+    snapshot->sequence = sequence;
+}
@@ -0,0 +1,170 @@
+#include <string.h>
+#include "pico/stdlib.h"
+#include "hardware/i2c.h"
+#include "ssd1306_i2c.h"
+#include "ssd1306.h"
+
+// Diagramação de texto numa caixa: quebra de linhas, alinhamento e reticências.
+// O resultado (trecho, posição e reticências de cada linha) fica guardado no ssd1306_layout_t,
+// então redesenhar o mesmo texto não mede nem quebra nada de novo.
+
+static const char ssd1306_ellipsis[] = "...";
+
+// Hash FNV-1a dos bytes de uma string (até o '\0'), para saber se o conteúdo mudou sem guardar cópia
+static uint32_t ssd1306_layout_hash(const char *text) {
+    uint32_t hash = 2166136261u;
+
+    while (*text) {
+        hash = (hash ^ (uint8_t)*text++) * 16777619u;
+    }
+    return hash;
+}
+
+// Quantas linhas da fonte cabem na altura da caixa
+static int ssd1306_layout_visible_lines(const ssd1306_layout_t *layout) {
+    int lines = layout->height / layout->font->height;
+    return lines < ssd1306_layout_max_lines ? lines : ssd1306_layout_max_lines;
+}
+
+// Posiciona uma linha na caixa: corta com reticências se não couber (ou se force_ellipsis) e alinha
+static void ssd1306_layout_place(const ssd1306_layout_t *layout, ssd1306_layout_line_t *line, const char *start, size_t length, bool force_ellipsis) {
+    const ssd1306_font_t *font = layout->font;
+
+    // Espaços no fim da linha não contam para o alinhamento
+    while (length > 0 && start[length - 1] == ' ') {
+        length--;
+    }
+
+    int width = ssd1306_measure_string_n(start, length, font);
+    bool ellipsis = force_ellipsis || width > layout->width;
+
+    if (ellipsis) {
+        int ellipsis_width = ssd1306_measure_string(ssd1306_ellipsis, font);
+        length = ssd1306_fit_string_n(start, length, font, layout->width - ellipsis_width - font->spacing);
+        while (length > 0 && start[length - 1] == ' ') {
+            length--;
+        }
+        width = length ? ssd1306_measure_string_n(start, length, font) + font->spacing + ellipsis_width : ellipsis_width;
+    }
+
+    line->start = start;
+    line->length = (uint16_t)length;
+    line->ellipsis = ellipsis;
+
+    switch (layout->align) {
+    case ssd1306_align_center:
+        line->x = layout->x + (layout->width - width) / 2;
+        break;
+    case ssd1306_align_right:
+        line->x = layout->x + layout->width - width;
+        break;
+    default:
+        line->x = layout->x;
+        break;
+    }
+}
+
+// Prepara uma caixa de texto vazia (em pixels); com wrap, linhas longas quebram no último espaço,
+// sem wrap, cada linha (separada por '\n') que não couber termina em "..."
+void ssd1306_layout_init(ssd1306_layout_t *layout, const ssd1306_font_t *font, int x, int y, int width, int height, ssd1306_align_t align, bool wrap) {
+    memset(layout, 0, sizeof(*layout));
+    layout->font = font;
+    layout->x = x;
+    layout->y = y;
+    layout->width = width;
+    layout->height = height;
+    layout->align = align;
+    layout->wrap = wrap;
+}
+
+// Diagrama o texto inteiro; se o conteúdo for o mesmo da última vez, não refaz nada e retorna false
+// O texto não é copiado: ele precisa continuar existindo (e sem mudanças) enquanto o layout for usado
+bool ssd1306_layout_set_text(ssd1306_layout_t *layout, const char *text) {
+    uint32_t hash = ssd1306_layout_hash(text);
+    if (layout->line_count && hash == layout->text_hash && layout->lines[0].start == text) {
+        return false;
+    }
+
+    int visible = ssd1306_layout_visible_lines(layout);
+    ssd1306_text_lines_t lines;
+    const char *start;
+    size_t length;
+
+    // Caixa mais baixa que a fonte: nenhuma linha cabe
+    if (visible <= 0) {
+        layout->line_count = 0;
+        layout->text_hash = hash;
+        return true;
+    }
+
+    ssd1306_text_lines_init(&lines, text, layout->font, layout->wrap ? layout->width : INT16_MAX);
+    layout->line_count = 0;
+
+    while (ssd1306_text_lines_next(&lines, &start, &length)) {
+        if (layout->line_count == visible) {
+            // Sobrou texto além da última linha visível: ela termina em "..."
+            ssd1306_layout_line_t *last = &layout->lines[visible - 1];
+            ssd1306_layout_place(layout, last, last->start, last->length, true);
+            break;
+        }
+        ssd1306_layout_line_t *line = &layout->lines[layout->line_count++];
+        ssd1306_layout_place(layout, line, start, length, false);
+        line->hash = 0;
+    }
+
+    layout->text_hash = hash;
+    return true;
+}
+
+// Troca o texto de uma única linha (ex.: um valor que muda), sem refazer as demais
+// A linha não quebra: se não couber, termina em "...". Retorna false se o conteúdo não mudou
+bool ssd1306_layout_set_line(ssd1306_layout_t *layout, int index, const char *text) {
+    if (index < 0 || index >= ssd1306_layout_visible_lines(layout)) {
+        return false;
+    }
+
+    ssd1306_layout_line_t *line = &layout->lines[index];
+    uint32_t hash = ssd1306_layout_hash(text);
+    if (index < layout->line_count && line->start == text && line->hash == hash) {
+        return false;
+    }
+
+    // Linhas ainda não usadas antes desta ficam vazias
+    while (layout->line_count <= index) {
+        ssd1306_layout_place(layout, &layout->lines[layout->line_count++], "", 0, false);
+    }
+
+    ssd1306_layout_place(layout, line, text, strlen(text), false);
+    line->hash = hash;
+    layout->text_hash = 0;
+    return true;
+}
+
+// Desenha uma linha já diagramada na sua posição
+static void ssd1306_layout_draw_placed(uint8_t *ssd, const ssd1306_layout_t *layout, int index, ssd1306_draw_mode_t mode) {
+    const ssd1306_layout_line_t *line = &layout->lines[index];
+    int y = layout->y + index * layout->font->height;
+    int x = ssd1306_draw_string_font_n(ssd, line->x, y, line->start, line->length, layout->font, mode);
+
+    if (line->ellipsis) {
+        ssd1306_draw_string_font(ssd, x, y, ssd1306_ellipsis, layout->font, mode);
+    }
+}
+
+// Desenha todas as linhas com as posições calculadas no último set_text/set_line
+void ssd1306_layout_draw(uint8_t *ssd, const ssd1306_layout_t *layout, ssd1306_draw_mode_t mode) {
+    for (int i = 0; i < layout->line_count; i++) {
+        ssd1306_layout_draw_placed(ssd, layout, i, mode);
+    }
+}
+
+// Redesenha só uma linha: apaga a faixa dela na caixa e desenha o conteúdo atual
+void ssd1306_layout_draw_line(uint8_t *ssd, const ssd1306_layout_t *layout, int index) {
+    if (index < 0 || index >= layout->line_count) {
+        return;
+    }
+
+    int y = layout->y + index * layout->font->height;
+    ssd1306_clear_rect(ssd, layout->x, y, layout->width, layout->font->height);
+    ssd1306_layout_draw_placed(ssd, layout, index, ssd1306_draw_or);
+}
@@ -0,0 +1,75 @@
+#include <string.h>
+#include "pico/stdlib.h"
+#include "pico/multicore.h"
+#include "ssd1306_i2c.h"
+#include "ssd1306.h"
+
+// Modo pipeline: o core1 é o único dono do barramento do display.
+// O core0 desenha num dos dois quadros (slots) livres e envia o índice pelo FIFO entre os cores;
+// o core1 copia o quadro para o seu back buffer, libera o slot e envia só o que mudou (ssd1306_present).
+
+#define ssd1306_pipeline_slots 2
+
+static struct {
+    uint8_t data[ssd1306_buffer_length];
+    uint32_t start_us;
+    volatile bool in_use; // true do envio pelo core0 até o core1 terminar de copiar
+} slots[ssd1306_pipeline_slots];
+
+static int drawing_slot = -1;
+static ssd1306_double_buffer_t display;
+static ssd1306_latency_t latency;
+
+// Laço do core1: consome pedidos de quadro e atualiza o display
+static void ssd1306_pipeline_core1_entry(void) {
+    while (true) {
+        uint32_t index = multicore_fifo_pop_blocking();
+        uint32_t start_us = slots[index].start_us;
+
+        memcpy(display.back.data, slots[index].data, ssd1306_buffer_length);
+        __dmb();
+        slots[index].in_use = false;
+
+        ssd1306_present(&display);
+        ssd1306_latency_record(&latency, start_us);
+    }
+}
+
+// Inicia o serviço de display no core1 (o display já deve estar inicializado e apagado)
+void ssd1306_pipeline_init() {
+    ssd1306_double_buffer_init(&display);
+    multicore_launch_core1(ssd1306_pipeline_core1_entry);
+}
+
+// Retorna um quadro zerado para o core0 desenhar, ou NULL se os dois ainda estiverem na fila do core1
+uint8_t *ssd1306_pipeline_begin_frame() {
+    for (int i = 0; i < ssd1306_pipeline_slots; i++) {
+        if (!slots[i].in_use) {
+            drawing_slot = i;
+            memset(slots[i].data, 0, ssd1306_buffer_length);
+            return slots[i].data;
+        }
+    }
+    return NULL;
+}
+
+// Envia ao core1 o quadro obtido em ssd1306_pipeline_begin_frame, sem bloquear
+// start_us marca o início da medição de latência (ex.: instante do aperto do botão)
+bool ssd1306_pipeline_submit(uint32_t start_us) {
+    if (drawing_slot < 0 || !multicore_fifo_wready()) {
+        return false;
+    }
+
+    slots[drawing_slot].start_us = start_us;
+    slots[drawing_slot].in_use = true;
+    __dmb();
+    multicore_fifo_push_blocking(drawing_slot);
+    drawing_slot = -1;
+
+    return true;
+}
+
+// Latência medida pelo core1 (do start_us informado até o fim do envio do quadro)
+ssd1306_latency_t *ssd1306_pipeline_latency() {
+    return &latency;
+}
@@ -0,0 +1,519 @@
+#include <stdlib.h>
+#include <limits.h>
+#include "pico/stdlib.h"
+#include "hardware/i2c.h"
+#include "ssd1306_i2c.h"
+#include "ssd1306.h"
+
+// Formas geométricas (retângulo, retângulo arredondado, círculo, elipse e triângulo), em contorno ou preenchidas.
+// O preenchimento é decomposto em faixas verticais (ssd1306_ctx_draw_vline): no framebuffer organizado em páginas,
+// uma coluna cobre um byte inteiro a cada 8 pixels, enquanto uma linha horizontal mexe em um bit por byte.
+// Cada forma é desenhada num contexto (ssd1306_ctx_*) e recortada ao retângulo atual dele; as versões que
+// recebem só o framebuffer usam um contexto da tela inteira.
+
+// Semieixos maiores que isso são reduzidos: os termos de erro da elipse crescem com r_x² * r_y (e cabem em 64 bits)
+#define ssd1306_max_ellipse_radius 0xFFFF
+
+// Verdadeiro se a caixa (limites inclusivos) de uma forma estiver toda fora do recorte atual: nada a desenhar
+static inline bool ssd1306_outside_clip(const ssd1306_context_t *ctx, int64_t x_0, int64_t y_0, int64_t x_1, int64_t y_1) {
+    const ssd1306_clip_t *clip = &ctx->clip[ctx->depth];
+    return x_1 < clip->x_0 || x_0 > clip->x_1 || y_1 < clip->y_0 || y_0 > clip->y_1 || clip->x_1 < clip->x_0 || clip->y_1 < clip->y_0;
+}
+
+// Cantos de um círculo, para os contornos do retângulo arredondado
+enum {
+    ssd1306_corner_top_left = 1,
+    ssd1306_corner_top_right = 2,
+    ssd1306_corner_bottom_right = 4,
+    ssd1306_corner_bottom_left = 8,
+    ssd1306_corner_all = 15,
+};
+
+// Lados de um círculo preenchido, para o preenchimento do retângulo arredondado
+enum {
+    ssd1306_side_right = 1,
+    ssd1306_side_left = 2,
+};
+
+// Contorno dos cantos escolhidos de um círculo de raio r centrado em (x_c, y_c), pelo algoritmo do ponto médio
+// Os quatro pontos nos eixos não são desenhados (no retângulo arredondado eles fazem parte dos lados retos)
+static void ssd1306_circle_corners(ssd1306_context_t *ctx, int x_c, int y_c, int r, int corners, bool set) {
+    int f = 1 - r; // Decisão do ponto médio
+    int dd_x = 1;
+    int dd_y = -2 * r;
+    int x = 0;
+    int y = r;
+
+    while (x < y) {
+        if (f >= 0) {
+            y--;
+            dd_y += 2;
+            f += dd_y;
+        }
+        x++;
+        dd_x += 2;
+        f += dd_x;
+
+        if (corners & ssd1306_corner_top_left) {
+            ssd1306_ctx_set_pixel(ctx, x_c - x, y_c - y, set);
+            ssd1306_ctx_set_pixel(ctx, x_c - y, y_c - x, set);
+        }
+        if (corners & ssd1306_corner_top_right) {
+            ssd1306_ctx_set_pixel(ctx, x_c + x, y_c - y, set);
+            ssd1306_ctx_set_pixel(ctx, x_c + y, y_c - x, set);
+        }
+        if (corners & ssd1306_corner_bottom_right) {
+            ssd1306_ctx_set_pixel(ctx, x_c + x, y_c + y, set);
+            ssd1306_ctx_set_pixel(ctx, x_c + y, y_c + x, set);
+        }
+        if (corners & ssd1306_corner_bottom_left) {
+            ssd1306_ctx_set_pixel(ctx, x_c - x, y_c + y, set);
+            ssd1306_ctx_set_pixel(ctx, x_c - y, y_c + x, set);
+        }
+    }
+}
+
+// Preenche as metades escolhidas de um círculo (sem a coluna central) com faixas verticais
+// stretch alonga cada faixa para baixo: é a altura do trecho reto entre os cantos do retângulo arredondado
+// Cada coluna é desenhada uma única vez, com a maior altura que o círculo tem nela
+static void ssd1306_fill_circle_sides(ssd1306_context_t *ctx, int x_c, int y_c, int r, int sides, int stretch, bool set) {
+    int f = 1 - r;
+    int dd_x = 1;
+    int dd_y = -2 * r;
+    int x = 0;
+    int y = r;
+    int previous_x = x;
+    int previous_y = y;
+
+    while (x < y) {
+        if (f >= 0) {
+            y--;
+            dd_y += 2;
+            f += dd_y;
+        }
+        x++;
+        dd_x += 2;
+        f += dd_x;
+
+        // Colunas x_c +- x: x muda a cada passo, então esta é a única vez que a coluna aparece
+        if (x < y + 1) {
+            if (sides & ssd1306_side_right) ssd1306_ctx_draw_vline(ctx, x_c + x, y_c - y, 2 * y + 1 + stretch, set);
+            if (sides & ssd1306_side_left) ssd1306_ctx_draw_vline(ctx, x_c - x, y_c - y, 2 * y + 1 + stretch, set);
+        }
+        // Colunas x_c +- y: desenhadas quando y vai mudar, com o maior x que elas alcançaram
+        if (y != previous_y) {
+            if (sides & ssd1306_side_right) ssd1306_ctx_draw_vline(ctx, x_c + previous_y, y_c - previous_x, 2 * previous_x + 1 + stretch, set);
+            if (sides & ssd1306_side_left) ssd1306_ctx_draw_vline(ctx, x_c - previous_y, y_c - previous_x, 2 * previous_x + 1 + stretch, set);
+            previous_y = y;
+        }
+        previous_x = x;
+    }
+}
+
+// Contorno de um retângulo de width x height pixels com o canto superior esquerdo em (x, y)
+void ssd1306_ctx_draw_rect(ssd1306_context_t *ctx, int x, int y, int width, int height, bool set) {
+    if (width <= 0 || height <= 0 || ssd1306_outside_clip(ctx, x, y, (int64_t)x + width - 1, (int64_t)y + height - 1)) {
+        return;
+    }
+
+    ssd1306_ctx_draw_hline(ctx, x, y, width, set);
+    ssd1306_ctx_draw_hline(ctx, x, y + height - 1, width, set);
+    ssd1306_ctx_draw_vline(ctx, x, y + 1, height - 2, set);
+    ssd1306_ctx_draw_vline(ctx, x + width - 1, y + 1, height - 2, set);
+}
+
+// Raio dos cantos limitado para que os dois cantos de um mesmo lado não se sobreponham
+static inline int ssd1306_corner_radius(int width, int height, int radius) {
+    int limit = ((width < height ? width : height) - 1) / 2;
+    return radius < 0 ? 0 : radius > limit ? limit : radius;
+}
+
+// Contorno de um retângulo com cantos arredondados de raio radius (ex.: botões)
+void ssd1306_ctx_draw_round_rect(ssd1306_context_t *ctx, int x, int y, int width, int height, int radius, bool set) {
+    if (width <= 0 || height <= 0 || ssd1306_outside_clip(ctx, x, y, (int64_t)x + width - 1, (int64_t)y + height - 1)) {
+        return;
+    }
+
+    int r = ssd1306_corner_radius(width, height, radius);
+    ssd1306_ctx_draw_hline(ctx, x + r, y, width - 2 * r, set);
+    ssd1306_ctx_draw_hline(ctx, x + r, y + height - 1, width - 2 * r, set);
+    ssd1306_ctx_draw_vline(ctx, x, y + r, height - 2 * r, set);
+    ssd1306_ctx_draw_vline(ctx, x + width - 1, y + r, height - 2 * r, set);
+
+    ssd1306_circle_corners(ctx, x + r, y + r, r, ssd1306_corner_top_left, set);
+    ssd1306_circle_corners(ctx, x + width - 1 - r, y + r, r, ssd1306_corner_top_right, set);
+    ssd1306_circle_corners(ctx, x + width - 1 - r, y + height - 1 - r, r, ssd1306_corner_bottom_right, set);
+    ssd1306_circle_corners(ctx, x + r, y + height - 1 - r, r, ssd1306_corner_bottom_left, set);
+}
+
+// Retângulo arredondado preenchido: o miolo é um retângulo só; as laterais, metades de círculo alongadas
+void ssd1306_ctx_fill_round_rect(ssd1306_context_t *ctx, int x, int y, int width, int height, int radius, bool set) {
+    if (width <= 0 || height <= 0 || ssd1306_outside_clip(ctx, x, y, (int64_t)x + width - 1, (int64_t)y + height - 1)) {
+        return;
+    }
+
+    int r = ssd1306_corner_radius(width, height, radius);
+    int stretch = height - 2 * r - 1;
+
+    ssd1306_ctx_fill_rect(ctx, x + r, y, width - 2 * r, height, set);
+    ssd1306_fill_circle_sides(ctx, x + width - 1 - r, y + r, r, ssd1306_side_right, stretch, set);
+    ssd1306_fill_circle_sides(ctx, x + r, y + r, r, ssd1306_side_left, stretch, set);
+}
+
+// Contorno de um círculo de raio r centrado em (x_c, y_c)
+void ssd1306_ctx_draw_circle(ssd1306_context_t *ctx, int x_c, int y_c, int r, bool set) {
+    if (r < 0 || ssd1306_outside_clip(ctx, (int64_t)x_c - r, (int64_t)y_c - r, (int64_t)x_c + r, (int64_t)y_c + r)) {
+        return;
+    }
+
+    ssd1306_ctx_set_pixel(ctx, x_c, y_c - r, set);
+    ssd1306_ctx_set_pixel(ctx, x_c, y_c + r, set);
+    ssd1306_ctx_set_pixel(ctx, x_c - r, y_c, set);
+    ssd1306_ctx_set_pixel(ctx, x_c + r, y_c, set);
+    ssd1306_circle_corners(ctx, x_c, y_c, r, ssd1306_corner_all, set);
+}
+
+// Círculo preenchido de raio r centrado em (x_c, y_c)
+void ssd1306_ctx_fill_circle(ssd1306_context_t *ctx, int x_c, int y_c, int r, bool set) {
+    if (r < 0 || ssd1306_outside_clip(ctx, (int64_t)x_c - r, (int64_t)y_c - r, (int64_t)x_c + r, (int64_t)y_c + r)) {
+        return;
+    }
+
+    ssd1306_ctx_draw_vline(ctx, x_c, y_c - r, 2 * r + 1, set);
+    ssd1306_fill_circle_sides(ctx, x_c, y_c, r, ssd1306_side_right | ssd1306_side_left, 0, set);
+}
+
+// Percorre um quadrante da elipse de semieixos r_x e r_y (algoritmo de Kennedy, só com inteiros) e, para
+// cada coluna x (0..r_x), desenha o contorno (os 4 pontos simétricos) ou a faixa vertical com a maior altura
+// que a elipse tem nessa coluna. Os termos crescem com r_x² * r_y: ficam em 64 bits, com os semieixos
+// limitados a ssd1306_max_ellipse_radius
+static void ssd1306_ellipse(ssd1306_context_t *ctx, int x_c, int y_c, int r_x, int r_y, bool fill, bool set) {
+    if (r_x > ssd1306_max_ellipse_radius) r_x = ssd1306_max_ellipse_radius;
+    if (r_y > ssd1306_max_ellipse_radius) r_y = ssd1306_max_ellipse_radius;
+
+    int64_t two_a2 = 2 * (int64_t)r_x * r_x;
+    int64_t two_b2 = 2 * (int64_t)r_y * r_y;
+
+    // Primeira parte, perto do eixo x: y avança sempre e x recua de vez em quando
+    int x = r_x, y = 0;
+    int64_t x_change = (int64_t)r_y * r_y * (1 - 2 * (int64_t)r_x);
+    int64_t y_change = (int64_t)r_x * r_x;
+    int64_t error = 0;
+    int64_t stopping_x = two_b2 * r_x;
+    int64_t stopping_y = 0;
+
+    while (stopping_x >= stopping_y) {
+        int column = x;
+        int height = y;
+
+        y++;
+        stopping_y += two_a2;
+        error += y_change;
+        y_change += two_a2;
+        if (2 * error + x_change > 0) {
+            x--;
+            stopping_x -= two_b2;
+            error += x_change;
+            x_change += two_b2;
+        }
+
+        if (!fill) {
+            ssd1306_ctx_set_pixel(ctx, x_c + column, y_c + height, set);
+            ssd1306_ctx_set_pixel(ctx, x_c - column, y_c + height, set);
+            ssd1306_ctx_set_pixel(ctx, x_c - column, y_c - height, set);
+            ssd1306_ctx_set_pixel(ctx, x_c + column, y_c - height, set);
+        }
+        // A coluna termina quando x vai recuar (ou a parte acaba): height é a maior altura dela
+        else if (x != column || stopping_x < stopping_y) {
+            ssd1306_ctx_draw_vline(ctx, x_c + column, y_c - height, 2 * height + 1, set);
+            ssd1306_ctx_draw_vline(ctx, x_c - column, y_c - height, 2 * height + 1, set);
+        }
+    }
+
+    // Segunda parte, perto do eixo y: x avança sempre e y recua de vez em quando
+    x = 0;
+    y = r_y;
+    x_change = (int64_t)r_y * r_y;
+    y_change = (int64_t)r_x * r_x * (1 - 2 * (int64_t)r_y);
+    error = 0;
+    stopping_x = 0;
+    stopping_y = two_a2 * r_y;
+
+    while (stopping_x <= stopping_y) {
+        // y só recua, então o primeiro ponto de cada coluna é o mais alto
+        if (!fill) {
+            ssd1306_ctx_set_pixel(ctx, x_c + x, y_c + y, set);
+            ssd1306_ctx_set_pixel(ctx, x_c - x, y_c + y, set);
+            ssd1306_ctx_set_pixel(ctx, x_c - x, y_c - y, set);
+            ssd1306_ctx_set_pixel(ctx, x_c + x, y_c - y, set);
+        }
+        else {
+            ssd1306_ctx_draw_vline(ctx, x_c + x, y_c - y, 2 * y + 1, set);
+            if (x) {
+                ssd1306_ctx_draw_vline(ctx, x_c - x, y_c - y, 2 * y + 1, set);
+            }
+        }
+
+        x++;
+        stopping_x += two_b2;
+        error += x_change;
+        x_change += two_b2;
+        if (2 * error + y_change > 0) {
+            y--;
+            stopping_y -= two_a2;
+            error += y_change;
+            y_change += two_a2;
+        }
+    }
+}
+
+// Contorno de uma elipse de semieixos r_x (horizontal) e r_y (vertical) centrada em (x_c, y_c)
+void ssd1306_ctx_draw_ellipse(ssd1306_context_t *ctx, int x_c, int y_c, int r_x, int r_y, bool set) {
+    if (r_x < 0 || r_y < 0 || ssd1306_outside_clip(ctx, (int64_t)x_c - r_x, (int64_t)y_c - r_y, (int64_t)x_c + r_x, (int64_t)y_c + r_y)) {
+        return;
+    }
+    if (r_x == 0 || r_y == 0) {
+        ssd1306_ctx_fill_rect(ctx, x_c - r_x, y_c - r_y, 2 * r_x + 1, 2 * r_y + 1, set);
+        return;
+    }
+
+    ssd1306_ellipse(ctx, x_c, y_c, r_x, r_y, false, set);
+}
+
+// Elipse preenchida de semieixos r_x e r_y centrada em (x_c, y_c)
+void ssd1306_ctx_fill_ellipse(ssd1306_context_t *ctx, int x_c, int y_c, int r_x, int r_y, bool set) {
+    if (r_x < 0 || r_y < 0 || ssd1306_outside_clip(ctx, (int64_t)x_c - r_x, (int64_t)y_c - r_y, (int64_t)x_c + r_x, (int64_t)y_c + r_y)) {
+        return;
+    }
+    if (r_x == 0 || r_y == 0) {
+        ssd1306_ctx_fill_rect(ctx, x_c - r_x, y_c - r_y, 2 * r_x + 1, 2 * r_y + 1, set);
+        return;
+    }
+
+    ssd1306_ellipse(ctx, x_c, y_c, r_x, r_y, true, set);
+}
+
+// Contorno de um triângulo
+void ssd1306_ctx_draw_triangle(ssd1306_context_t *ctx, int x_0, int y_0, int x_1, int y_1, int x_2, int y_2, bool set) {
+    ssd1306_ctx_draw_line(ctx, x_0, y_0, x_1, y_1, set);
+    ssd1306_ctx_draw_line(ctx, x_1, y_1, x_2, y_2, set);
+    ssd1306_ctx_draw_line(ctx, x_2, y_2, x_0, y_0, set);
+}
+
+// floor((n * k + b) / d) para valores consecutivos de k, só com somas (n >= 0, d > 0)
+typedef struct {
+    int value;
+    int step;      // n / d
+    int remainder; // n % d
+    int error;     // Resto acumulado, em [0, d)
+    int d;
+} ssd1306_ramp_t;
+
+static void ssd1306_ramp_init(ssd1306_ramp_t *ramp, int n, int b, int d, int k) {
+    int64_t numerator = (int64_t)n * k + b;
+    int64_t quotient = numerator >= 0 ? numerator / d : -((-numerator + d - 1) / d);
+
+    ramp->value = (int)quotient;
+    ramp->error = (int)(numerator - quotient * d);
+    ramp->step = n / d;
+    ramp->remainder = n % d;
+    ramp->d = d;
+}
+
+// k + 1 (forward) ou k - 1
+static inline void ssd1306_ramp_move(ssd1306_ramp_t *ramp, bool forward) {
+    if (forward) {
+        ramp->value += ramp->step;
+        ramp->error += ramp->remainder;
+        if (ramp->error >= ramp->d) {
+            ramp->error -= ramp->d;
+            ramp->value++;
+        }
+    }
+    else {
+        ramp->value -= ramp->step;
+        ramp->error -= ramp->remainder;
+        if (ramp->error < 0) {
+            ramp->error += ramp->d;
+            ramp->value--;
+        }
+    }
+}
+
+// Uma aresta do triângulo percorrida coluna a coluna, com os mesmos pixels que ssd1306_ctx_draw_line desenha
+// de (x_a, y_a) até (x_b, y_b). No passo i do eixo maior, o eixo menor avança floor((2 * minor * i + major) / (2 * major));
+// na coluna k = |x - x_a|, isso dá:
+// - linha mais horizontal (dx >= dy): um pixel, com avanço floor((2 dy k + dx) / 2 dx)
+// - linha mais vertical: os passos de floor((2 dy k - dy - 1) / 2 dx) + 1 até floor((2 dy k + dy - 1) / 2 dx)
+typedef struct {
+    int x_first, x_last; // Colunas cobertas
+    int x, y_a, y_b, sy, dy;
+    bool forward;        // k cresce com x (a aresta vai para a direita)
+    bool x_major;
+    ssd1306_ramp_t high; // Avanço (dx >= dy) ou último passo da coluna
+    ssd1306_ramp_t low;  // Último passo da coluna anterior
+} ssd1306_edge_t;
+
+// Prepara a aresta posicionada na coluna x (ou na primeira que ela cobre, se x estiver antes)
+static void ssd1306_edge_init(ssd1306_edge_t *edge, int x_a, int y_a, int x_b, int y_b, int x) {
+    int dx = abs(x_b - x_a);
+    int dy = abs(y_b - y_a);
+
+    edge->x_first = x_a < x_b ? x_a : x_b;
+    edge->x_last = x_a > x_b ? x_a : x_b;
+    edge->x = x > edge->x_first ? x : edge->x_first;
+    edge->y_a = y_a;
+    edge->y_b = y_b;
+    edge->sy = y_a < y_b ? 1 : -1;
+    edge->dy = dy;
+    edge->forward = x_a < x_b;
+    edge->x_major = dx >= dy;
+
+    if (dx == 0) {
+        return; // Vertical (ou um ponto): uma coluna só, de y_a a y_b
+    }
+
+    int k = abs(edge->x - x_a);
+    if (edge->x_major) {
+        ssd1306_ramp_init(&edge->high, 2 * dy, dx, 2 * dx, k);
+    }
+    else {
+        ssd1306_ramp_init(&edge->high, 2 * dy, dy - 1, 2 * dx, k);
+        ssd1306_ramp_init(&edge->low, 2 * dy, -dy - 1, 2 * dx, k);
+    }
+}
+
+// Faixa de y que a aresta ocupa na coluna atual; depois passa para a próxima coluna
+static inline void ssd1306_edge_span(ssd1306_edge_t *edge, int *top, int *bottom) {
+    int y_0, y_1;
+
+    if (edge->x_first == edge->x_last) {
+        y_0 = edge->y_a;
+        y_1 = edge->y_b;
+    }
+    else if (edge->x_major) {
+        y_0 = y_1 = edge->y_a + edge->sy * edge->high.value;
+    }
+    else {
+        int first = edge->low.value + 1;
+        int last = edge->high.value;
+        y_0 = edge->y_a + edge->sy * (first > 0 ? first : 0);
+        y_1 = edge->y_a + edge->sy * (last < edge->dy ? last : edge->dy);
+    }
+
+    if (y_0 > y_1) {
+        int swap = y_0;
+        y_0 = y_1;
+        y_1 = swap;
+    }
+    if (y_0 < *top) *top = y_0;
+    if (y_1 > *bottom) *bottom = y_1;
+
+    if (edge->x_first != edge->x_last) {
+        ssd1306_ramp_move(&edge->high, edge->forward);
+        if (!edge->x_major) {
+            ssd1306_ramp_move(&edge->low, edge->forward);
+        }
+    }
+    edge->x++;
+}
+
+// Triângulo preenchido, coluna a coluna: cada coluna é uma faixa vertical do pixel mais alto ao mais baixo que
+// as arestas (as mesmas linhas de ssd1306_ctx_draw_triangle) têm nela, então o preenchimento sempre cobre o
+// contorno. As arestas avançam por soma, sem divisão por coluna
+void ssd1306_ctx_fill_triangle(ssd1306_context_t *ctx, int x_0, int y_0, int x_1, int y_1, int x_2, int y_2, bool set) {
+    int left = x_0 < x_1 ? (x_0 < x_2 ? x_0 : x_2) : (x_1 < x_2 ? x_1 : x_2);
+    int right = x_0 > x_1 ? (x_0 > x_2 ? x_0 : x_2) : (x_1 > x_2 ? x_1 : x_2);
+    int top = y_0 < y_1 ? (y_0 < y_2 ? y_0 : y_2) : (y_1 < y_2 ? y_1 : y_2);
+    int bottom = y_0 > y_1 ? (y_0 > y_2 ? y_0 : y_2) : (y_1 > y_2 ? y_1 : y_2);
+
+    if (ssd1306_outside_clip(ctx, left, top, right, bottom)) {
+        return;
+    }
+
+    // Só as colunas dentro do recorte são percorridas
+    const ssd1306_clip_t *clip = &ctx->clip[ctx->depth];
+    int first = left > clip->x_0 ? left : clip->x_0;
+    int last = right < clip->x_1 ? right : clip->x_1;
+
+    ssd1306_edge_t edges[3];
+    ssd1306_edge_init(&edges[0], x_0, y_0, x_1, y_1, first);
+    ssd1306_edge_init(&edges[1], x_1, y_1, x_2, y_2, first);
+    ssd1306_edge_init(&edges[2], x_2, y_2, x_0, y_0, first);
+
+    for (int x = first; x <= last; x++) {
+        int span_top = INT_MAX;
+        int span_bottom = INT_MIN;
+
+        for (int i = 0; i < 3; i++) {
+            if (edges[i].x == x && x <= edges[i].x_last) {
+                ssd1306_edge_span(&edges[i], &span_top, &span_bottom);
+            }
+        }
+        ssd1306_ctx_draw_vline(ctx, x, span_top, span_bottom - span_top + 1, set);
+    }
+}
+
+// Versões das formas na tela inteira, sem contexto
+void ssd1306_draw_rect(uint8_t *ssd, int x, int y, int width, int height, bool set) {
+    ssd1306_context_t ctx;
+
+    ssd1306_ctx_init(&ctx, ssd);
+    ssd1306_ctx_draw_rect(&ctx, x, y, width, height, set);
+}
+
+void ssd1306_draw_round_rect(uint8_t *ssd, int x, int y, int width, int height, int radius, bool set) {
+    ssd1306_context_t ctx;
+
+    ssd1306_ctx_init(&ctx, ssd);
+    ssd1306_ctx_draw_round_rect(&ctx, x, y, width, height, radius, set);
+}
+
+void ssd1306_fill_round_rect(uint8_t *ssd, int x, int y, int width, int height, int radius, bool set) {
+    ssd1306_context_t ctx;
+
+    ssd1306_ctx_init(&ctx, ssd);
+    ssd1306_ctx_fill_round_rect(&ctx, x, y, width, height, radius, set);
+}
+
+void ssd1306_draw_circle(uint8_t *ssd, int x_c, int y_c, int r, bool set) {
+    ssd1306_context_t ctx;
+
+    ssd1306_ctx_init(&ctx, ssd);
+    ssd1306_ctx_draw_circle(&ctx, x_c, y_c, r, set);
+}
+
+void ssd1306_fill_circle(uint8_t *ssd, int x_c, int y_c, int r, bool set) {
+    ssd1306_context_t ctx;
+
+    ssd1306_ctx_init(&ctx, ssd);
+    ssd1306_ctx_fill_circle(&ctx, x_c, y_c, r, set);
+}
+
+void ssd1306_draw_ellipse(uint8_t *ssd, int x_c, int y_c, int r_x, int r_y, bool set) {
+    ssd1306_context_t ctx;
+
+    ssd1306_ctx_init(&ctx, ssd);
+    ssd1306_ctx_draw_ellipse(&ctx, x_c, y_c, r_x, r_y, set);
+}
+
+void ssd1306_fill_ellipse(uint8_t *ssd, int x_c, int y_c, int r_x, int r_y, bool set) {
+    ssd1306_context_t ctx;
+
+    ssd1306_ctx_init(&ctx, ssd);
+    ssd1306_ctx_fill_ellipse(&ctx, x_c, y_c, r_x, r_y, set);
+}
+
+void ssd1306_draw_triangle(uint8_t *ssd, int x_0, int y_0, int x_1, int y_1, int x_2, int y_2, bool set) {
+    ssd1306_context_t ctx;
+
+    ssd1306_ctx_init(&ctx, ssd);
+    ssd1306_ctx_draw_triangle(&ctx, x_0, y_0, x_1, y_1, x_2, y_2, set);
+}
+
+void ssd1306_fill_triangle(uint8_t *ssd, int x_0, int y_0, int x_1, int y_1, int x_2, int y_2, bool set) {
+    ssd1306_context_t ctx;
+
+    ssd1306_ctx_init(&ctx, ssd);
+    ssd1306_ctx_fill_triangle(&ctx, x_0, y_0, x_1, y_1, x_2, y_2, set);
+}
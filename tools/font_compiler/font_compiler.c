@@ -0,0 +1,274 @@
+// Compilador de fontes (roda no computador, não na placa)
+//
+// Converte uma fonte BDF (ou TTF, se compilado com FreeType) em tabelas const no formato de ssd1306_font_t:
+// cada glifo vira (altura + 7) / 8 linhas de página com "largura" bytes verticais (bit 0 = pixel de cima),
+// exatamente como ssd1306_draw_glyph consome, mais os índices de deslocamento e largura por caractere.
+//
+// Uso: font_compiler [opções] <entrada.bdf|entrada.ttf> <saida.h>
+//   -n nome       nome da fonte gerada (padrão: ssd1306_font)
+//   -r 0x20-0x7E  faixa de caracteres (padrão: 0x20-0x7E)
+//   -s pixels     altura da célula; obrigatório para TTF (padrão para BDF: FONT_ASCENT + FONT_DESCENT)
+//   -w colunas    largura fixa: todos os glifos com a mesma largura (sem tabelas de índice)
+//   -p colunas    espaçamento acrescentado após cada glifo (padrão: 0)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef FONT_COMPILER_FREETYPE
+#include <ft2build.h>
+#include FT_FREETYPE_H
+#endif
+
+#define max_glyph_width 64
+#define max_glyph_height 64
+
+// Glifo já rasterizado na célula: pixels[linha][coluna], linha 0 = topo da célula
+typedef struct {
+    bool present;
+    int width; // Colunas usadas (avanço)
+    uint8_t pixels[max_glyph_height][max_glyph_width];
+} glyph_t;
+
+static glyph_t glyphs[256];
+
+static void fail(const char *message, const char *detail) {
+    fprintf(stderr, "font_compiler: %s%s%s\n", message, detail ? ": " : "", detail ? detail : "");
+    exit(1);
+}
+
+static bool has_suffix(const char *text, const char *suffix) {
+    size_t n = strlen(text), m = strlen(suffix);
+    return n >= m && strcmp(text + n - m, suffix) == 0;
+}
+
+// Lê uma fonte BDF; retorna a altura da célula (ascent + descent)
+static int load_bdf(const char *path, int first, int last) {
+    FILE *file = fopen(path, "r");
+    if (!file) {
+        fail("não foi possível abrir", path);
+    }
+
+    char line[512];
+    int ascent = 0, descent = 0;
+    int encoding = -1, advance = 0;
+    int bbx_w = 0, bbx_h = 0, bbx_x = 0, bbx_y = 0;
+    int row = -1;
+
+    while (fgets(line, sizeof(line), file)) {
+        if (sscanf(line, "FONT_ASCENT %d", &ascent) == 1 || sscanf(line, "FONT_DESCENT %d", &descent) == 1) {
+            continue;
+        }
+        if (sscanf(line, "ENCODING %d", &encoding) == 1 || sscanf(line, "DWIDTH %d", &advance) == 1) {
+            continue;
+        }
+        if (sscanf(line, "BBX %d %d %d %d", &bbx_w, &bbx_h, &bbx_x, &bbx_y) == 4) {
+            continue;
+        }
+        if (strncmp(line, "BITMAP", 6) == 0) {
+            row = 0;
+            if (encoding >= first && encoding <= last) {
+                if (advance > max_glyph_width || ascent + descent > max_glyph_height) {
+                    fail("glifo grande demais", path);
+                }
+                glyphs[encoding].present = true;
+                glyphs[encoding].width = advance;
+            }
+            continue;
+        }
+        if (strncmp(line, "ENDCHAR", 7) == 0) {
+            row = -1;
+            encoding = -1;
+            continue;
+        }
+        if (row < 0 || encoding < first || encoding > last) {
+            continue;
+        }
+
+        // Linha do bitmap em hexadecimal, bit mais significativo = coluna mais à esquerda
+        int y = ascent - (bbx_y + bbx_h) + row++;
+        int bits = (int)strlen(line) / 2 * 8;
+        for (int i = 0; i < bbx_w; i++) {
+            char digit[2] = {line[i / 4], 0};
+            int nibble = (int)strtol(digit, NULL, 16);
+            int x = bbx_x + i;
+            if ((nibble >> (3 - i % 4)) & 1 && x >= 0 && x < max_glyph_width && y >= 0 && y < max_glyph_height && i < bits) {
+                glyphs[encoding].pixels[y][x] = 1;
+            }
+        }
+    }
+
+    fclose(file);
+    return ascent + descent;
+}
+
+#ifdef FONT_COMPILER_FREETYPE
+// Rasteriza uma fonte TTF em preto e branco (sem antisserrilhado) com a altura de célula pedida
+static void load_ttf(const char *path, int height, int first, int last) {
+    FT_Library library;
+    FT_Face face;
+
+    if (FT_Init_FreeType(&library) || FT_New_Face(library, path, 0, &face)) {
+        fail("não foi possível abrir", path);
+    }
+    FT_Set_Pixel_Sizes(face, 0, height);
+    int ascent = (int)(face->size->metrics.ascender >> 6);
+
+    for (int c = first; c <= last; c++) {
+        if (!FT_Get_Char_Index(face, c) || FT_Load_Char(face, c, FT_LOAD_RENDER | FT_LOAD_TARGET_MONO)) {
+            continue;
+        }
+        FT_GlyphSlot slot = face->glyph;
+        FT_Bitmap *bitmap = &slot->bitmap;
+
+        glyphs[c].present = true;
+        glyphs[c].width = (int)(slot->advance.x >> 6);
+        if (glyphs[c].width > max_glyph_width) {
+            fail("glifo grande demais", path);
+        }
+        for (unsigned int r = 0; r < bitmap->rows; r++) {
+            for (unsigned int i = 0; i < bitmap->width; i++) {
+                int x = slot->bitmap_left + (int)i;
+                int y = ascent - slot->bitmap_top + (int)r;
+                if ((bitmap->buffer[r * bitmap->pitch + i / 8] >> (7 - i % 8)) & 1 &&
+                    x >= 0 && x < max_glyph_width && y >= 0 && y < height) {
+                    glyphs[c].pixels[y][x] = 1;
+                }
+            }
+        }
+    }
+
+    FT_Done_Face(face);
+    FT_Done_FreeType(library);
+}
+#endif
+
+// Escreve as colunas de um glifo no formato de página (bit 0 = pixel de cima de cada página)
+static void write_glyph(FILE *out, const glyph_t *glyph, int width, int height, int c) {
+    fprintf(out, "   ");
+    for (int page = 0; page < (height + 7) / 8; page++) {
+        for (int x = 0; x < width; x++) {
+            uint8_t byte = 0;
+            for (int bit = 0; bit < 8 && page * 8 + bit < height; bit++) {
+                if (glyph->pixels[page * 8 + bit][x]) {
+                    byte |= 1u << bit;
+                }
+            }
+            fprintf(out, " 0x%02x,", byte);
+        }
+    }
+    if (c > ' ' && c < 0x7F && c != '\\') {
+        fprintf(out, " // %c\n", c);
+    } else {
+        fprintf(out, " // 0x%02X\n", c);
+    }
+}
+
+int main(int argc, char **argv) {
+    const char *name = "ssd1306_font";
+    const char *input = NULL, *output = NULL;
+    int first = 0x20, last = 0x7E;
+    int height = 0, fixed_width = 0, spacing = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (argv[i][0] == '-' && argv[i][1] && !argv[i][2] && i + 1 < argc) {
+            const char *value = argv[++i];
+            switch (argv[i - 1][1]) {
+            case 'n': name = value; break;
+            case 'r':
+                if (sscanf(value, "%i-%i", &first, &last) != 2 || first < 0 || last > 255 || first > last) {
+                    fail("faixa inválida", value);
+                }
+                break;
+            case 's': height = atoi(value); break;
+            case 'w': fixed_width = atoi(value); break;
+            case 'p': spacing = atoi(value); break;
+            default: fail("opção desconhecida", argv[i - 1]);
+            }
+        } else if (!input) {
+            input = argv[i];
+        } else if (!output) {
+            output = argv[i];
+        } else {
+            fail("argumento a mais", argv[i]);
+        }
+    }
+    if (!input || !output) {
+        fprintf(stderr, "uso: font_compiler [-n nome] [-r primeiro-último] [-s altura] [-w largura fixa] [-p espaçamento] <entrada.bdf|.ttf> <saída.h>\n");
+        return 1;
+    }
+
+    if (has_suffix(input, ".bdf")) {
+        int cell_height = load_bdf(input, first, last);
+        if (!height) {
+            height = cell_height;
+        }
+    } else {
+#ifdef FONT_COMPILER_FREETYPE
+        if (!height) {
+            fail("informe a altura (-s) para fontes TTF", input);
+        }
+        load_ttf(input, height, first, last);
+#else
+        fail("compilado sem FreeType; só aceita BDF", input);
+#endif
+    }
+    if (height <= 0 || height > max_glyph_height || fixed_width > max_glyph_width) {
+        fail("tamanho de célula inválido", input);
+    }
+
+    FILE *out = fopen(output, "w");
+    if (!out) {
+        fail("não foi possível criar", output);
+    }
+
+    int pages = (height + 7) / 8;
+    fprintf(out, "// Gerado por tools/font_compiler a partir de %s; não edite\n", input);
+    fprintf(out, "// %d pixels de altura, caracteres 0x%02X a 0x%02X\n\n", height, first, last);
+
+    fprintf(out, "static const uint8_t %s_data[] = {\n", name);
+    int offset = 0;
+    int offsets[256], widths[256];
+    for (int c = first; c <= last; c++) {
+        int width = fixed_width ? fixed_width : (glyphs[c].present ? glyphs[c].width : 0);
+        offsets[c] = offset;
+        widths[c] = width;
+        if (width) {
+            write_glyph(out, &glyphs[c], width, height, c);
+        }
+        offset += width * pages;
+    }
+    fprintf(out, "};\n\n");
+
+    if (!fixed_width) {
+        fprintf(out, "static const uint16_t %s_offsets[] = {", name);
+        for (int c = first; c <= last; c++) {
+            fprintf(out, "%s%d,", (c - first) % 16 ? " " : "\n    ", offsets[c]);
+        }
+        fprintf(out, "\n};\n\n");
+
+        fprintf(out, "static const uint8_t %s_widths[] = {", name);
+        for (int c = first; c <= last; c++) {
+            fprintf(out, "%s%d,", (c - first) % 16 ? " " : "\n    ", widths[c]);
+        }
+        fprintf(out, "\n};\n\n");
+    }
+
+    fprintf(out, "const ssd1306_font_t %s = {\n", name);
+    fprintf(out, "    .data = %s_data,\n", name);
+    if (!fixed_width) {
+        fprintf(out, "    .offsets = %s_offsets,\n", name);
+        fprintf(out, "    .widths = %s_widths,\n", name);
+    }
+    fprintf(out, "    .first_char = 0x%02X,\n", first);
+    fprintf(out, "    .last_char = 0x%02X,\n", last);
+    fprintf(out, "    .height = %d,\n", height);
+    fprintf(out, "    .fixed_width = %d,\n", fixed_width);
+    fprintf(out, "    .spacing = %d,\n", spacing);
+    fprintf(out, "};\n");
+
+    fclose(out);
+    return 0;
+}
@@ -0,0 +1,214 @@
+// Micro-benchmark: ssd1306_draw_line (Bresenham recortado e incremental) contra o Bresenham anterior
+//
+// O desenho anterior (um ssd1306_set_pixel por ponto, com índice e deslocamento recalculados a cada
+// pixel) está copiado abaixo. Os dois desenham as mesmas linhas, dentro da tela, em buffers com faixas
+// sujas acompanhadas; antes de medir, o resultado de cada caso é comparado byte a byte.
+// O tempo é o do computador (não o relógio virtual do host_sdk): compile com -O2 para comparar.
+//
+// Uso: bench_line [repetições]   (padrão 2000)
+// Retorna 1 se os dois desenhos divergirem.
+
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "pico/stdlib.h"
+#include "hardware/i2c.h"
+#include "ssd1306.h"
+#include "host_sdk.h"
+
+#define segment_count 256
+
+typedef struct {
+    int x_0, y_0, x_1, y_1;
+} segment_t;
+
+typedef struct {
+    const char *name;
+    segment_t segments[segment_count];
+    int count;
+} bench_case_t;
+
+/* ======================================================================
+ * Desenho anterior (inc/ssd1306_draw.c antes do Bresenham recortado)
+ * ====================================================================== */
+
+static ssd1306_dirty_t old_dirty;
+
+static inline void old_mark_dirty_column(int page, int column) {
+    if (!old_dirty.pages[page].is_dirty) {
+        old_dirty.pages[page].is_dirty = true;
+        old_dirty.pages[page].min_column = column;
+        old_dirty.pages[page].max_column = column;
+    }
+    else if (column < old_dirty.pages[page].min_column) {
+        old_dirty.pages[page].min_column = column;
+    }
+    else if (column > old_dirty.pages[page].max_column) {
+        old_dirty.pages[page].max_column = column;
+    }
+}
+
+static void old_set_pixel(uint8_t *ssd, int x, int y, bool set) {
+    const int bytes_per_row = ssd1306_width;
+
+    int byte_idx = (y / 8) * bytes_per_row + x;
+    uint8_t byte = ssd[byte_idx];
+
+    if (set) {
+        byte |= 1 << (y % 8);
+    }
+    else {
+        byte &= ~(1 << (y % 8));
+    }
+
+    if (byte != ssd[byte_idx]) {
+        ssd[byte_idx] = byte;
+        old_mark_dirty_column(y / 8, x);
+    }
+}
+
+static void old_draw_line(uint8_t *ssd, int x_0, int y_0, int x_1, int y_1, bool set) {
+    int dx = abs(x_1 - x_0);
+    int dy = -abs(y_1 - y_0);
+    int sx = x_0 < x_1 ? 1 : -1;
+    int sy = y_0 < y_1 ? 1 : -1;
+    int error = dx + dy;
+    int error_2;
+
+    while (true) {
+        old_set_pixel(ssd, x_0, y_0, set);
+        if (x_0 == x_1 && y_0 == y_1) {
+            break;
+        }
+
+        error_2 = 2 * error;
+
+        if (error_2 >= dy) {
+            error += dy;
+            x_0 += sx;
+        }
+        if (error_2 <= dx) {
+            error += dx;
+            y_0 += sy;
+        }
+    }
+}
+
+/* ====================================================================== */
+
+static uint8_t old_frame[ssd1306_buffer_length];
+static uint8_t new_frame[ssd1306_buffer_length];
+static ssd1306_dirty_t new_dirty;
+static ssd1306_context_t new_ctx; // Desenho em new_frame acumulando as faixas em new_dirty, como no display
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void case_random(bench_case_t *c) {
+    c->name = "diagonais aleatórias";
+    c->count = segment_count;
+    for (int i = 0; i < segment_count; i++) {
+        c->segments[i] = (segment_t){
+            rand() % ssd1306_width, rand() % ssd1306_height,
+            rand() % ssd1306_width, rand() % ssd1306_height
+        };
+    }
+}
+
+static void case_grid(bench_case_t *c) {
+    c->name = "grade horizontal/vertical";
+    c->count = 0;
+    for (int y = 0; y < ssd1306_height; y += 4) {
+        c->segments[c->count++] = (segment_t){0, y, ssd1306_width - 1, y};
+    }
+    for (int x = 0; x < ssd1306_width; x += 4) {
+        c->segments[c->count++] = (segment_t){x, 0, x, ssd1306_height - 1};
+    }
+}
+
+static void case_shallow(bench_case_t *c) {
+    c->name = "diagonais longas";
+    c->count = 0;
+    for (int y = 0; y < ssd1306_height && c->count < segment_count; y++) {
+        c->segments[c->count++] = (segment_t){0, y, ssd1306_width - 1, ssd1306_height - 1 - y};
+    }
+}
+
+// Desenha todos os segmentos (acendendo e depois apagando, para que os bytes mudem a cada repetição)
+static void draw_old(const bench_case_t *c) {
+    for (int set = 1; set >= 0; set--) {
+        for (int i = 0; i < c->count; i++) {
+            const segment_t *s = &c->segments[i];
+            old_draw_line(old_frame, s->x_0, s->y_0, s->x_1, s->y_1, set);
+        }
+    }
+}
+
+static void draw_new(const bench_case_t *c) {
+    for (int set = 1; set >= 0; set--) {
+        for (int i = 0; i < c->count; i++) {
+            const segment_t *s = &c->segments[i];
+            ssd1306_ctx_draw_line(&new_ctx, s->x_0, s->y_0, s->x_1, s->y_1, set);
+        }
+    }
+}
+
+// Uma passada só acendendo, nos dois desenhos, e comparação dos quadros
+static bool same_output(const bench_case_t *c) {
+    memset(old_frame, 0, sizeof(old_frame));
+    memset(new_frame, 0, sizeof(new_frame));
+    for (int i = 0; i < c->count; i++) {
+        const segment_t *s = &c->segments[i];
+        old_draw_line(old_frame, s->x_0, s->y_0, s->x_1, s->y_1, true);
+        ssd1306_ctx_draw_line(&new_ctx, s->x_0, s->y_0, s->x_1, s->y_1, true);
+    }
+    return memcmp(old_frame, new_frame, sizeof(old_frame)) == 0;
+}
+
+int main(int argc, char **argv) {
+    int repetitions = argc > 1 ? atoi(argv[1]) : 2000;
+    static bench_case_t cases[3];
+    int failures = 0;
+
+    host_sdk_reset();
+    ssd1306_ctx_init(&new_ctx, new_frame);
+    new_ctx.dirty = &new_dirty;
+    srand(1);
+    case_random(&cases[0]);
+    case_grid(&cases[1]);
+    case_shallow(&cases[2]);
+
+    printf("%-28s %12s %12s %8s\n", "caso", "anterior", "atual", "ganho");
+    for (int i = 0; i < (int)count_of(cases); i++) {
+        const bench_case_t *c = &cases[i];
+
+        if (!same_output(c)) {
+            printf("%-28s desenhos diferentes\n", c->name);
+            failures++;
+            continue;
+        }
+
+        double start = now_seconds();
+        for (int r = 0; r < repetitions; r++) {
+            draw_old(c);
+        }
+        double old_s = now_seconds() - start;
+
+        start = now_seconds();
+        for (int r = 0; r < repetitions; r++) {
+            draw_new(c);
+        }
+        double new_s = now_seconds() - start;
+
+        // ns por linha desenhada
+        double lines = 2.0 * c->count * repetitions;
+        printf("%-28s %9.1f ns %9.1f ns %7.2fx\n", c->name, old_s * 1e9 / lines, new_s * 1e9 / lines, old_s / new_s);
+    }
+
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,12 @@
+// SDK mínimo (host): clk_sys fixo no valor padrão do RP2040
+#pragma once
+
+#include "pico/stdlib.h"
+
+enum clock_index {
+    clk_sys = 5,
+};
+
+#define host_sdk_clk_sys_hz 125000000u
+
+extern uint32_t clock_get_hz(enum clock_index clock);
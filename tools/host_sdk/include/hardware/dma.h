@@ -0,0 +1,33 @@
+// SDK mínimo (host): canais de DMA simulados, só no sentido memória -> IC_DATA_CMD do I2C
+// Como no RP2040, a transferência termina quando a última palavra entra no FIFO de 16 posições do I2C:
+// aí a interrupção DMA_IRQ_0 é chamada, se habilitada, com IC_STATUS ainda ativo. O controlador fica
+// ocioso (TFE, sem MST_ACTIVITY) ao fim do tempo de barramento, quando as transações são entregues.
+#pragma once
+
+#include "pico/stdlib.h"
+
+#define NUM_DMA_CHANNELS 12
+
+enum dma_channel_transfer_size {
+    DMA_SIZE_8 = 0,
+    DMA_SIZE_16 = 1,
+    DMA_SIZE_32 = 2,
+};
+
+typedef struct {
+    uint32_t ctrl;
+} dma_channel_config;
+
+extern int dma_claim_unused_channel(bool required);
+extern dma_channel_config dma_channel_get_default_config(uint channel);
+extern void channel_config_set_transfer_data_size(dma_channel_config *c, enum dma_channel_transfer_size size);
+extern void channel_config_set_read_increment(dma_channel_config *c, bool incr);
+extern void channel_config_set_write_increment(dma_channel_config *c, bool incr);
+extern void channel_config_set_dreq(dma_channel_config *c, uint dreq);
+extern void dma_channel_configure(uint channel, const dma_channel_config *config, volatile void *write_addr,
+                                  const volatile void *read_addr, uint transfer_count, bool trigger);
+extern void dma_channel_transfer_from_buffer_now(uint channel, const volatile void *read_addr, uint32_t transfer_count);
+extern bool dma_channel_is_busy(uint channel);
+extern void dma_channel_set_irq0_enabled(uint channel, bool enabled);
+extern bool dma_channel_get_irq0_status(uint channel);
+extern void dma_channel_acknowledge_irq0(uint channel);
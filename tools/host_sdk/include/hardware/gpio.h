@@ -0,0 +1,39 @@
+// SDK mínimo (host): pinos simulados; a entrada é definida pelo teste com host_sdk_gpio_set_input,
+// que também dispara o callback de interrupção das bordas habilitadas
+#pragma once
+
+#include "pico/stdlib.h"
+
+#define NUM_BANK0_GPIOS 30
+
+#define GPIO_IN false
+#define GPIO_OUT true
+
+enum gpio_function {
+    GPIO_FUNC_SPI = 1,
+    GPIO_FUNC_UART = 2,
+    GPIO_FUNC_I2C = 3,
+    GPIO_FUNC_PWM = 4,
+    GPIO_FUNC_SIO = 5,
+    GPIO_FUNC_NULL = 0x1F,
+};
+
+enum gpio_irq_level {
+    GPIO_IRQ_LEVEL_LOW = 0x1u,
+    GPIO_IRQ_LEVEL_HIGH = 0x2u,
+    GPIO_IRQ_EDGE_FALL = 0x4u,
+    GPIO_IRQ_EDGE_RISE = 0x8u,
+};
+
+typedef void (*gpio_irq_callback_t)(uint gpio, uint32_t event_mask);
+
+extern void gpio_init(uint gpio);
+extern void gpio_set_function(uint gpio, enum gpio_function function);
+extern void gpio_set_dir(uint gpio, bool out);
+extern void gpio_pull_up(uint gpio);
+extern void gpio_pull_down(uint gpio);
+extern void gpio_disable_pulls(uint gpio);
+extern bool gpio_get(uint gpio);
+extern void gpio_put(uint gpio, bool value);
+extern void gpio_set_irq_enabled(uint gpio, uint32_t events, bool enabled);
+extern void gpio_set_irq_enabled_with_callback(uint gpio, uint32_t events, bool enabled, gpio_irq_callback_t callback);
@@ -0,0 +1,45 @@
+// SDK mínimo (host): controladores I2C simulados
+// Cada escrita é registrada, avança o relógio virtual pelo tempo de barramento e é entregue ao
+// host_sdk_i2c_hook_t instalado (ex.: o emulador de tools/ssd1306_emulator); sem gancho, os bytes se perdem
+#pragma once
+
+#include "pico/stdlib.h"
+
+// Registradores usados pelo envio por DMA (inc/ssd1306_async.c)
+typedef struct {
+    volatile uint32_t enable;
+    volatile uint32_t tar;
+    volatile uint32_t data_cmd;
+    volatile uint32_t status;
+} i2c_hw_t;
+
+#define I2C_IC_STATUS_TFE_BITS _u(0x00000004)
+#define I2C_IC_STATUS_MST_ACTIVITY_BITS _u(0x00000020)
+#define I2C_IC_DATA_CMD_STOP_BITS _u(0x00000200)
+#define I2C_IC_DATA_CMD_RESTART_BITS _u(0x00000400)
+
+typedef struct i2c_inst {
+    i2c_hw_t *hw;
+    uint baudrate;
+} i2c_inst_t;
+
+extern i2c_inst_t i2c0_inst;
+extern i2c_inst_t i2c1_inst;
+
+#define i2c0 (&i2c0_inst)
+#define i2c1 (&i2c1_inst)
+
+static inline uint i2c_hw_index(i2c_inst_t *i2c) {
+    return i2c == i2c1 ? 1u : 0u;
+}
+
+static inline i2c_hw_t *i2c_get_hw(i2c_inst_t *i2c) {
+    return i2c->hw;
+}
+
+static inline uint i2c_get_dreq(i2c_inst_t *i2c, bool is_tx) {
+    return 32u + i2c_hw_index(i2c) * 2u + (is_tx ? 0u : 1u);
+}
+
+extern uint i2c_init(i2c_inst_t *i2c, uint baudrate);
+extern int i2c_write_blocking(i2c_inst_t *i2c, uint8_t addr, const uint8_t *src, size_t len, bool nostop);
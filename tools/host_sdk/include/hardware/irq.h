@@ -0,0 +1,12 @@
+// SDK mínimo (host): só a interrupção do DMA, chamada pelo canal simulado ao fim da transferência
+#pragma once
+
+#include "pico/stdlib.h"
+
+#define DMA_IRQ_0 11
+#define PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY 0x80
+
+typedef void (*irq_handler_t)(void);
+
+extern void irq_add_shared_handler(uint num, irq_handler_t handler, uint8_t order_priority);
+extern void irq_set_enabled(uint num, bool enabled);
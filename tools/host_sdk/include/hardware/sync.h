@@ -0,0 +1,13 @@
+// SDK mínimo (host): não há outro núcleo nem interrupções reais; os eventos só rodam nas esperas
+#pragma once
+
+#include "pico/stdlib.h"
+
+#define __compiler_memory_barrier() __asm__ volatile("" ::: "memory")
+#define __dmb() __compiler_memory_barrier()
+
+extern uint32_t save_and_disable_interrupts(void);
+extern void restore_interrupts(uint32_t status);
+
+// Dorme até o próximo evento: avança o relógio virtual até ele e o executa
+extern void __wfi(void);
@@ -0,0 +1,70 @@
+// Controle e inspeção do SDK simulado (biblioteca host_sdk), para testes, benchmarks e ferramentas no computador
+//
+// - Tempo: relógio virtual em microssegundos; sleep_*, esperas ativas, __wfi e escritas I2C o avançam
+//   e disparam os alarmes e fins de DMA que vencerem no caminho
+// - Registro: cada chamada aos periféricos entra no log, com o instante virtual e até três argumentos
+// - Periféricos: nível de entrada dos pinos, estado das fatias de PWM e um gancho que recebe cada
+//   transação I2C completa (endereço + bytes)
+#pragma once
+
+#include "pico/stdlib.h"
+#include "hardware/i2c.h"
+
+typedef enum {
+    host_sdk_call_i2c_init,          // i2c, baudrate
+    host_sdk_call_i2c_write,         // endereço, bytes, duração em us
+    host_sdk_call_gpio_init,         // pino
+    host_sdk_call_gpio_set_function, // pino, função
+    host_sdk_call_gpio_set_dir,      // pino, saída
+    host_sdk_call_gpio_set_pulls,    // pino, pull-up, pull-down
+    host_sdk_call_gpio_put,          // pino, nível
+    host_sdk_call_gpio_set_irq,      // pino, bordas, habilitado
+    host_sdk_call_pwm_set_clkdiv,    // fatia, divisor em 1/16
+    host_sdk_call_pwm_set_wrap,      // fatia, wrap
+    host_sdk_call_pwm_set_level,     // fatia, canal, nível
+    host_sdk_call_pwm_set_enabled,   // fatia, habilitado
+    host_sdk_call_alarm_add,         // id, atraso em us
+    host_sdk_call_alarm_cancel,      // id
+    host_sdk_call_alarm_fire,        // id
+    host_sdk_call_sleep,             // duração em us
+    host_sdk_call_dma_start,         // canal, palavras
+    host_sdk_call_dma_complete,      // canal
+    host_sdk_call_max
+} host_sdk_call_id_t;
+
+typedef struct {
+    uint64_t time_us;
+    host_sdk_call_id_t id;
+    uint32_t args[3];
+} host_sdk_call_t;
+
+#define host_sdk_log_size 4096 // Chamadas guardadas; as seguintes só entram nas contagens
+
+// Estado de uma fatia de PWM
+typedef struct {
+    uint16_t div16; // Divisor em ponto fixo 8.4
+    uint16_t wrap;
+    uint16_t level[2];
+    bool enabled;
+} host_sdk_pwm_slice_t;
+
+// Recebe cada transação I2C completa (START, endereço, bytes, STOP)
+typedef void (*host_sdk_i2c_hook_t)(i2c_inst_t *i2c, uint8_t addr, const uint8_t *bytes, size_t length, void *user_data);
+
+// Volta ao estado do reset: relógio em 0, log vazio, sem alarmes, pinos e PWM zerados (o gancho I2C é mantido)
+extern void host_sdk_reset(void);
+
+extern uint64_t host_sdk_time_us(void);
+extern void host_sdk_advance_us(uint64_t us);
+extern bool host_sdk_run_next_event(void);
+
+extern uint32_t host_sdk_call_count(host_sdk_call_id_t id);
+extern size_t host_sdk_log(const host_sdk_call_t **calls);
+extern void host_sdk_clear_log(void);
+
+extern void host_sdk_gpio_set_input(uint gpio, bool level);
+extern bool host_sdk_gpio_output(uint gpio);
+extern const host_sdk_pwm_slice_t *host_sdk_pwm_slice(uint slice_num);
+
+extern void host_sdk_set_i2c_hook(host_sdk_i2c_hook_t hook, void *user_data);
+extern uint32_t host_sdk_i2c_bus_time_us(i2c_inst_t *i2c, size_t length);
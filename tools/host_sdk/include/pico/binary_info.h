@@ -0,0 +1,4 @@
+// SDK mínimo (host): as informações binárias só existem na imagem da placa
+#pragma once
+
+#define bi_decl(...)
@@ -0,0 +1,41 @@
+// SDK mínimo para compilar no computador (host) o código do projeto
+// - sem ligar a biblioteca host_sdk (tools/page_baker): só os tipos e macros, para o desenho no framebuffer
+//   (inc/ssd1306_draw.c) e o conteúdo das páginas (inc/pages.c)
+// - ligado à host_sdk (tools/host_sdk/CMakeLists.txt): tempo virtual, alarmes e periféricos simulados,
+//   que registram cada chamada (ver host_sdk.h)
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <assert.h>
+
+typedef unsigned int uint;
+
+#define _u(x) x##u
+#define count_of(a) (sizeof(a) / sizeof((a)[0]))
+
+// Tempo: um relógio virtual em microssegundos, que só anda com sleep_*, esperas e host_sdk_advance_us
+typedef uint64_t absolute_time_t;
+
+extern uint64_t time_us_64(void);
+extern uint32_t time_us_32(void);
+extern absolute_time_t get_absolute_time(void);
+extern int64_t absolute_time_diff_us(absolute_time_t from, absolute_time_t to);
+extern uint32_t to_ms_since_boot(absolute_time_t t);
+extern void sleep_us(uint64_t us);
+extern void sleep_ms(uint32_t ms);
+
+// Alarmes: disparam quando o relógio virtual passa do instante agendado
+// Retorno do callback: 0 encerra; > 0 reagenda em relação ao disparo anterior; < 0 em relação a agora
+typedef int32_t alarm_id_t;
+typedef int64_t (*alarm_callback_t)(alarm_id_t id, void *user_data);
+
+extern alarm_id_t add_alarm_in_us(uint64_t us, alarm_callback_t callback, void *user_data, bool fire_if_past);
+extern alarm_id_t add_alarm_in_ms(uint32_t ms, alarm_callback_t callback, void *user_data, bool fire_if_past);
+extern bool cancel_alarm(alarm_id_t alarm_id);
+
+// Laços de espera ativa avançam o relógio até o próximo evento (alarme ou fim de DMA)
+extern void tight_loop_contents(void);
+
+extern bool stdio_init_all(void);
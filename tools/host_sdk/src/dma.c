@@ -0,0 +1,227 @@
+#include <string.h>
+#include "pico/stdlib.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/i2c.h"
+#include "host_sdk_internal.h"
+
+#define host_sdk_max_irq_handlers 4
+#define host_sdk_i2c_tx_fifo_depth 16 // IC_TX_FIFO do RP2040
+
+// Campos de dma_channel_config::ctrl (só os que a simulação usa)
+#define dma_ctrl_size_mask 0x3u
+#define dma_ctrl_read_increment 0x4u
+#define dma_ctrl_write_increment 0x8u
+#define dma_ctrl_dreq_shift 8
+
+typedef struct {
+    bool claimed;
+    bool busy;
+    bool irq0_enabled;
+    bool irq0_status;
+    uint32_t ctrl;
+    volatile void *write_addr;
+    const volatile void *read_addr;
+    uint32_t count;
+} host_sdk_dma_channel_t;
+
+static host_sdk_dma_channel_t channels[NUM_DMA_CHANNELS];
+static irq_handler_t dma_irq_handlers[host_sdk_max_irq_handlers];
+static int dma_irq_handler_count = 0;
+static bool dma_irq_enabled = false;
+
+void host_sdk_dma_reset(void) {
+    memset(channels, 0, sizeof(channels));
+    dma_irq_handler_count = 0;
+    dma_irq_enabled = false;
+}
+
+int dma_claim_unused_channel(bool required) {
+    for (int i = 0; i < NUM_DMA_CHANNELS; i++) {
+        if (!channels[i].claimed) {
+            channels[i].claimed = true;
+            return i;
+        }
+    }
+    assert(!required);
+    return -1;
+}
+
+dma_channel_config dma_channel_get_default_config(uint channel) {
+    (void)channel;
+
+    dma_channel_config config = {DMA_SIZE_32 | dma_ctrl_read_increment};
+    return config;
+}
+
+void channel_config_set_transfer_data_size(dma_channel_config *c, enum dma_channel_transfer_size size) {
+    c->ctrl = (c->ctrl & ~dma_ctrl_size_mask) | size;
+}
+
+void channel_config_set_read_increment(dma_channel_config *c, bool incr) {
+    c->ctrl = incr ? (c->ctrl | dma_ctrl_read_increment) : (c->ctrl & ~dma_ctrl_read_increment);
+}
+
+void channel_config_set_write_increment(dma_channel_config *c, bool incr) {
+    c->ctrl = incr ? (c->ctrl | dma_ctrl_write_increment) : (c->ctrl & ~dma_ctrl_write_increment);
+}
+
+void channel_config_set_dreq(dma_channel_config *c, uint dreq) {
+    c->ctrl = (c->ctrl & 0xFFu) | (dreq << dma_ctrl_dreq_shift);
+}
+
+// Controlador I2C cujo IC_DATA_CMD é o destino do canal (NULL se for outro destino)
+static i2c_inst_t *dma_target_i2c(const host_sdk_dma_channel_t *ch) {
+    if (ch->write_addr == &i2c0->hw->data_cmd) {
+        return i2c0;
+    }
+    if (ch->write_addr == &i2c1->hw->data_cmd) {
+        return i2c1;
+    }
+    return NULL;
+}
+
+// Palavra "index" da origem, no tamanho configurado
+static uint32_t dma_read_word(const host_sdk_dma_channel_t *ch, uint32_t index) {
+    uint32_t i = (ch->ctrl & dma_ctrl_read_increment) ? index : 0;
+
+    switch (ch->ctrl & dma_ctrl_size_mask) {
+    case DMA_SIZE_8:
+        return ((const volatile uint8_t *)ch->read_addr)[i];
+    case DMA_SIZE_16:
+        return ((const volatile uint16_t *)ch->read_addr)[i];
+    default:
+        return ((const volatile uint32_t *)ch->read_addr)[i];
+    }
+}
+
+// Percorre as palavras de IC_DATA_CMD, separando as transações pelo bit de STOP
+// Com "deliver", entrega cada uma ao I2C simulado; retorna o tempo total de barramento
+static uint32_t dma_i2c_transactions(host_sdk_dma_channel_t *ch, i2c_inst_t *i2c, bool deliver) {
+    static uint8_t bytes[4096];
+    size_t length = 0;
+    uint32_t duration = 0;
+
+    for (uint32_t i = 0; i < ch->count; i++) {
+        uint32_t word = dma_read_word(ch, i);
+
+        if (length < sizeof(bytes)) {
+            bytes[length++] = (uint8_t)word;
+        }
+        if ((word & I2C_IC_DATA_CMD_STOP_BITS) || i == ch->count - 1) {
+            duration += host_sdk_i2c_bus_time_us(i2c, length);
+            if (deliver) {
+                host_sdk_i2c_deliver(i2c, (uint8_t)i2c->hw->tar, bytes, length);
+            }
+            length = 0;
+        }
+    }
+    return duration;
+}
+
+// Último byte fora do FIFO: as transações chegam ao barramento e o controlador fica ocioso
+static int64_t dma_i2c_drained(alarm_id_t id, void *user_data) {
+    host_sdk_dma_channel_t *ch = user_data;
+    i2c_inst_t *i2c = dma_target_i2c(ch);
+    (void)id;
+
+    dma_i2c_transactions(ch, i2c, true);
+    i2c->hw->status = I2C_IC_STATUS_TFE_BITS;
+    return 0;
+}
+
+// Fim da transferência: a última palavra entrou no FIFO (que ainda está esvaziando) e a
+// interrupção do canal é sinalizada
+static int64_t dma_complete(alarm_id_t id, void *user_data) {
+    host_sdk_dma_channel_t *ch = user_data;
+    (void)id;
+
+    ch->busy = false;
+    host_sdk_record(host_sdk_call_dma_complete, (uint32_t)(ch - channels), 0, 0);
+
+    if (ch->irq0_enabled) {
+        ch->irq0_status = true;
+        if (dma_irq_enabled) {
+            for (int i = 0; i < dma_irq_handler_count; i++) {
+                dma_irq_handlers[i]();
+            }
+        }
+    }
+    return 0;
+}
+
+static void dma_start(host_sdk_dma_channel_t *ch) {
+    i2c_inst_t *i2c = dma_target_i2c(ch);
+    uint32_t duration = i2c ? dma_i2c_transactions(ch, i2c, false) : 0;
+
+    uint32_t fifo = 0;
+
+    // Com o I2C como destino, o DMA termina quando as últimas palavras entram no FIFO;
+    // o barramento só fica ocioso depois que elas saem
+    if (i2c) {
+        uint32_t words = ch->count < host_sdk_i2c_tx_fifo_depth ? ch->count : host_sdk_i2c_tx_fifo_depth;
+        fifo = host_sdk_i2c_bus_time_us(i2c, words) - host_sdk_i2c_bus_time_us(i2c, 0);
+        if (fifo > duration) {
+            fifo = duration;
+        }
+        i2c->hw->status = I2C_IC_STATUS_MST_ACTIVITY_BITS;
+    }
+
+    ch->busy = true;
+    host_sdk_record(host_sdk_call_dma_start, (uint32_t)(ch - channels), ch->count, 0);
+    host_sdk_schedule(host_sdk_time_us() + duration - fifo, dma_complete, ch, false);
+    if (i2c) {
+        host_sdk_schedule(host_sdk_time_us() + duration, dma_i2c_drained, ch, false);
+    }
+}
+
+void dma_channel_configure(uint channel, const dma_channel_config *config, volatile void *write_addr,
+                           const volatile void *read_addr, uint transfer_count, bool trigger) {
+    host_sdk_dma_channel_t *ch = &channels[channel];
+
+    ch->ctrl = config->ctrl;
+    ch->write_addr = write_addr;
+    ch->read_addr = read_addr;
+    ch->count = transfer_count;
+    if (trigger) {
+        dma_start(ch);
+    }
+}
+
+void dma_channel_transfer_from_buffer_now(uint channel, const volatile void *read_addr, uint32_t transfer_count) {
+    host_sdk_dma_channel_t *ch = &channels[channel];
+
+    ch->read_addr = read_addr;
+    ch->count = transfer_count;
+    dma_start(ch);
+}
+
+bool dma_channel_is_busy(uint channel) {
+    return channels[channel].busy;
+}
+
+void dma_channel_set_irq0_enabled(uint channel, bool enabled) {
+    channels[channel].irq0_enabled = enabled;
+}
+
+bool dma_channel_get_irq0_status(uint channel) {
+    return channels[channel].irq0_status;
+}
+
+void dma_channel_acknowledge_irq0(uint channel) {
+    channels[channel].irq0_status = false;
+}
+
+void irq_add_shared_handler(uint num, irq_handler_t handler, uint8_t order_priority) {
+    (void)order_priority;
+
+    if (num == DMA_IRQ_0 && dma_irq_handler_count < host_sdk_max_irq_handlers) {
+        dma_irq_handlers[dma_irq_handler_count++] = handler;
+    }
+}
+
+void irq_set_enabled(uint num, bool enabled) {
+    if (num == DMA_IRQ_0) {
+        dma_irq_enabled = enabled;
+    }
+}
@@ -0,0 +1,109 @@
+#include <string.h>
+#include "pico/stdlib.h"
+#include "hardware/gpio.h"
+#include "host_sdk_internal.h"
+
+typedef struct {
+    bool out;
+    bool pull_up;
+    bool pull_down;
+    bool output;       // Nível escrito com gpio_put
+    bool driven;       // A entrada foi definida por host_sdk_gpio_set_input
+    bool input;
+    uint32_t irq_events;
+} host_sdk_gpio_t;
+
+static host_sdk_gpio_t pins[NUM_BANK0_GPIOS];
+static gpio_irq_callback_t irq_callback = NULL;
+
+void host_sdk_gpio_reset(void) {
+    memset(pins, 0, sizeof(pins));
+    irq_callback = NULL;
+}
+
+void gpio_init(uint gpio) {
+    host_sdk_record(host_sdk_call_gpio_init, gpio, 0, 0);
+    pins[gpio].out = false;
+    pins[gpio].output = false;
+}
+
+void gpio_set_function(uint gpio, enum gpio_function function) {
+    host_sdk_record(host_sdk_call_gpio_set_function, gpio, function, 0);
+}
+
+void gpio_set_dir(uint gpio, bool out) {
+    host_sdk_record(host_sdk_call_gpio_set_dir, gpio, out, 0);
+    pins[gpio].out = out;
+}
+
+static void gpio_set_pulls(uint gpio, bool up, bool down) {
+    host_sdk_record(host_sdk_call_gpio_set_pulls, gpio, up, down);
+    pins[gpio].pull_up = up;
+    pins[gpio].pull_down = down;
+}
+
+void gpio_pull_up(uint gpio) {
+    gpio_set_pulls(gpio, true, false);
+}
+
+void gpio_pull_down(uint gpio) {
+    gpio_set_pulls(gpio, false, true);
+}
+
+void gpio_disable_pulls(uint gpio) {
+    gpio_set_pulls(gpio, false, false);
+}
+
+// Saída: o nível escrito; entrada: o nível imposto pelo teste ou, sem ele, o dos resistores internos
+bool gpio_get(uint gpio) {
+    const host_sdk_gpio_t *pin = &pins[gpio];
+
+    if (pin->out) {
+        return pin->output;
+    }
+    return pin->driven ? pin->input : pin->pull_up;
+}
+
+void gpio_put(uint gpio, bool value) {
+    host_sdk_record(host_sdk_call_gpio_put, gpio, value, 0);
+    pins[gpio].output = value;
+}
+
+void gpio_set_irq_enabled(uint gpio, uint32_t events, bool enabled) {
+    host_sdk_record(host_sdk_call_gpio_set_irq, gpio, events, enabled);
+    if (enabled) {
+        pins[gpio].irq_events |= events;
+    }
+    else {
+        pins[gpio].irq_events &= ~events;
+    }
+}
+
+void gpio_set_irq_enabled_with_callback(uint gpio, uint32_t events, bool enabled, gpio_irq_callback_t callback) {
+    gpio_set_irq_enabled(gpio, events, enabled);
+    if (enabled) {
+        irq_callback = callback;
+    }
+}
+
+// Muda o nível externo do pino; uma borda habilitada chama o callback na hora, como a interrupção faria
+void host_sdk_gpio_set_input(uint gpio, bool level) {
+    host_sdk_gpio_t *pin = &pins[gpio];
+    bool before = gpio_get(gpio);
+
+    pin->driven = true;
+    pin->input = level;
+
+    if (before == level || pin->out) {
+        return;
+    }
+
+    uint32_t event = level ? GPIO_IRQ_EDGE_RISE : GPIO_IRQ_EDGE_FALL;
+    if ((pin->irq_events & event) && irq_callback) {
+        irq_callback(gpio, event);
+    }
+}
+
+bool host_sdk_gpio_output(uint gpio) {
+    return pins[gpio].output;
+}
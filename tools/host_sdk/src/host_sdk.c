@@ -0,0 +1,247 @@
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "hardware/sync.h"
+#include "hardware/clocks.h"
+#include "host_sdk_internal.h"
+
+// Alarmes e eventos internos pendentes (o SDK da placa também tem um número fixo de alarmes)
+#define host_sdk_max_events 32
+
+typedef struct {
+    bool used;
+    bool record;
+    alarm_id_t id;
+    uint64_t target_us;
+    alarm_callback_t callback;
+    void *user_data;
+} host_sdk_event_t;
+
+static uint64_t now_us = 0;
+static host_sdk_event_t events[host_sdk_max_events];
+static alarm_id_t next_id = 1;
+
+static host_sdk_call_t log_calls[host_sdk_log_size];
+static size_t log_length = 0;
+static uint32_t call_counts[host_sdk_call_max];
+
+/* ======================================================================
+ * Registro de chamadas
+ * ====================================================================== */
+
+void host_sdk_record(host_sdk_call_id_t id, uint32_t arg0, uint32_t arg1, uint32_t arg2) {
+    call_counts[id]++;
+
+    if (log_length < host_sdk_log_size) {
+        host_sdk_call_t *call = &log_calls[log_length++];
+        call->time_us = now_us;
+        call->id = id;
+        call->args[0] = arg0;
+        call->args[1] = arg1;
+        call->args[2] = arg2;
+    }
+}
+
+// Quantas vezes a chamada ocorreu desde o último host_sdk_reset (inclui as que não couberam no log)
+uint32_t host_sdk_call_count(host_sdk_call_id_t id) {
+    return call_counts[id];
+}
+
+// Chamadas registradas, em ordem; retorna quantas são
+size_t host_sdk_log(const host_sdk_call_t **calls) {
+    *calls = log_calls;
+    return log_length;
+}
+
+void host_sdk_clear_log(void) {
+    log_length = 0;
+    memset(call_counts, 0, sizeof(call_counts));
+}
+
+void host_sdk_reset(void) {
+    now_us = 0;
+    next_id = 1;
+    memset(events, 0, sizeof(events));
+    host_sdk_clear_log();
+
+    host_sdk_gpio_reset();
+    host_sdk_pwm_reset();
+    host_sdk_dma_reset();
+    host_sdk_i2c_reset();
+}
+
+/* ======================================================================
+ * Relógio virtual e eventos
+ * ====================================================================== */
+
+alarm_id_t host_sdk_schedule(uint64_t target_us, alarm_callback_t callback, void *user_data, bool record) {
+    for (int i = 0; i < host_sdk_max_events; i++) {
+        host_sdk_event_t *event = &events[i];
+        if (event->used) {
+            continue;
+        }
+
+        event->used = true;
+        event->record = record;
+        event->id = next_id++;
+        event->target_us = target_us;
+        event->callback = callback;
+        event->user_data = user_data;
+        return event->id;
+    }
+    return -1;
+}
+
+// Evento pendente mais cedo até "limit" (empate: o agendado primeiro)
+static host_sdk_event_t *host_sdk_next_event(uint64_t limit) {
+    host_sdk_event_t *next = NULL;
+
+    for (int i = 0; i < host_sdk_max_events; i++) {
+        host_sdk_event_t *event = &events[i];
+        if (!event->used || event->target_us > limit) {
+            continue;
+        }
+        if (!next || event->target_us < next->target_us ||
+            (event->target_us == next->target_us && event->id < next->id)) {
+            next = event;
+        }
+    }
+    return next;
+}
+
+// Leva o relógio ao instante do evento e o executa; o retorno do callback decide se ele é reagendado
+static void host_sdk_fire(host_sdk_event_t *event) {
+    alarm_id_t id = event->id;
+
+    if (event->target_us > now_us) {
+        now_us = event->target_us;
+    }
+    if (event->record) {
+        host_sdk_record(host_sdk_call_alarm_fire, (uint32_t)id, 0, 0);
+    }
+
+    int64_t result = event->callback(id, event->user_data);
+
+    // O callback pode ter cancelado o próprio alarme
+    if (!event->used || event->id != id) {
+        return;
+    }
+    if (result == 0) {
+        event->used = false;
+    }
+    else if (result > 0) {
+        event->target_us += (uint64_t)result;
+    }
+    else {
+        event->target_us = now_us + (uint64_t)-result;
+    }
+}
+
+uint64_t host_sdk_time_us(void) {
+    return now_us;
+}
+
+// Avança o relógio, executando em ordem os eventos que vencerem no intervalo
+void host_sdk_advance_us(uint64_t us) {
+    uint64_t end = now_us + us;
+    host_sdk_event_t *event;
+
+    while ((event = host_sdk_next_event(end)) != NULL) {
+        host_sdk_fire(event);
+    }
+    if (end > now_us) {
+        now_us = end;
+    }
+}
+
+// Salta até o próximo evento pendente e o executa; retorna false se não houver nenhum
+bool host_sdk_run_next_event(void) {
+    host_sdk_event_t *event = host_sdk_next_event(UINT64_MAX);
+
+    if (!event) {
+        return false;
+    }
+    host_sdk_fire(event);
+    return true;
+}
+
+uint64_t time_us_64(void) {
+    return now_us;
+}
+
+uint32_t time_us_32(void) {
+    return (uint32_t)now_us;
+}
+
+absolute_time_t get_absolute_time(void) {
+    return now_us;
+}
+
+int64_t absolute_time_diff_us(absolute_time_t from, absolute_time_t to) {
+    return (int64_t)(to - from);
+}
+
+uint32_t to_ms_since_boot(absolute_time_t t) {
+    return (uint32_t)(t / 1000);
+}
+
+void sleep_us(uint64_t us) {
+    host_sdk_record(host_sdk_call_sleep, (uint32_t)us, 0, 0);
+    host_sdk_advance_us(us);
+}
+
+void sleep_ms(uint32_t ms) {
+    sleep_us((uint64_t)ms * 1000);
+}
+
+alarm_id_t add_alarm_in_us(uint64_t us, alarm_callback_t callback, void *user_data, bool fire_if_past) {
+    (void)fire_if_past;
+
+    alarm_id_t id = host_sdk_schedule(now_us + us, callback, user_data, true);
+    host_sdk_record(host_sdk_call_alarm_add, (uint32_t)id, (uint32_t)us, 0);
+    return id;
+}
+
+alarm_id_t add_alarm_in_ms(uint32_t ms, alarm_callback_t callback, void *user_data, bool fire_if_past) {
+    return add_alarm_in_us((uint64_t)ms * 1000, callback, user_data, fire_if_past);
+}
+
+bool cancel_alarm(alarm_id_t alarm_id) {
+    host_sdk_record(host_sdk_call_alarm_cancel, (uint32_t)alarm_id, 0, 0);
+
+    for (int i = 0; i < host_sdk_max_events; i++) {
+        if (events[i].used && events[i].id == alarm_id) {
+            events[i].used = false;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Espera ativa: em vez de girar sem fim, salta para o próximo evento (ou anda 1 us se não houver)
+void tight_loop_contents(void) {
+    if (!host_sdk_run_next_event()) {
+        now_us++;
+    }
+}
+
+void __wfi(void) {
+    tight_loop_contents();
+}
+
+uint32_t save_and_disable_interrupts(void) {
+    return 0;
+}
+
+void restore_interrupts(uint32_t status) {
+    (void)status;
+}
+
+uint32_t clock_get_hz(enum clock_index clock) {
+    (void)clock;
+    return host_sdk_clk_sys_hz;
+}
+
+bool stdio_init_all(void) {
+    return true;
+}
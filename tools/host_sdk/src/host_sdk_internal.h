@@ -0,0 +1,19 @@
+// Partes do SDK simulado compartilhadas entre os módulos de tools/host_sdk/src
+#pragma once
+
+#include "pico/stdlib.h"
+#include "hardware/i2c.h"
+#include "host_sdk.h"
+
+extern void host_sdk_record(host_sdk_call_id_t id, uint32_t arg0, uint32_t arg1, uint32_t arg2);
+
+// Agenda um evento no instante absoluto target_us (mesmas regras de retorno dos alarmes);
+// com record = false ele não aparece no log (ex.: o fim de uma transferência de DMA)
+extern alarm_id_t host_sdk_schedule(uint64_t target_us, alarm_callback_t callback, void *user_data, bool record);
+
+extern void host_sdk_i2c_deliver(i2c_inst_t *i2c, uint8_t addr, const uint8_t *bytes, size_t length);
+
+extern void host_sdk_gpio_reset(void);
+extern void host_sdk_pwm_reset(void);
+extern void host_sdk_dma_reset(void);
+extern void host_sdk_i2c_reset(void);
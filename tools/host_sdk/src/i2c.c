@@ -0,0 +1,67 @@
+#include "pico/stdlib.h"
+#include "hardware/i2c.h"
+#include "host_sdk_internal.h"
+
+// Sem i2c_init, o SDK da placa deixa o controlador em 100 kHz
+#define host_sdk_i2c_default_baudrate 100000u
+
+// FIFO vazio e barramento ocioso, exceto durante uma transferência por DMA (ver dma.c):
+// as escritas bloqueantes terminam antes de retornar
+static i2c_hw_t i2c_hw[2] = {
+    {.status = I2C_IC_STATUS_TFE_BITS},
+    {.status = I2C_IC_STATUS_TFE_BITS},
+};
+
+i2c_inst_t i2c0_inst = {&i2c_hw[0], 0};
+i2c_inst_t i2c1_inst = {&i2c_hw[1], 0};
+
+static host_sdk_i2c_hook_t hook = NULL;
+static void *hook_user_data = NULL;
+
+void host_sdk_i2c_reset(void) {
+    for (int i = 0; i < 2; i++) {
+        i2c_hw[i].enable = 0;
+        i2c_hw[i].tar = 0;
+        i2c_hw[i].data_cmd = 0;
+        i2c_hw[i].status = I2C_IC_STATUS_TFE_BITS;
+    }
+    i2c0_inst.baudrate = 0;
+    i2c1_inst.baudrate = 0;
+}
+
+void host_sdk_set_i2c_hook(host_sdk_i2c_hook_t new_hook, void *user_data) {
+    hook = new_hook;
+    hook_user_data = user_data;
+}
+
+// START + endereço + STOP e 9 bits (com ACK) por byte, na velocidade configurada
+uint32_t host_sdk_i2c_bus_time_us(i2c_inst_t *i2c, size_t length) {
+    uint64_t baudrate = i2c->baudrate ? i2c->baudrate : host_sdk_i2c_default_baudrate;
+    uint64_t bits = (uint64_t)(length + 1) * 9 + 2;
+
+    return (uint32_t)((bits * 1000000 + baudrate - 1) / baudrate);
+}
+
+void host_sdk_i2c_deliver(i2c_inst_t *i2c, uint8_t addr, const uint8_t *bytes, size_t length) {
+    host_sdk_record(host_sdk_call_i2c_write, addr, (uint32_t)length, host_sdk_i2c_bus_time_us(i2c, length));
+    if (hook) {
+        hook(i2c, addr, bytes, length, hook_user_data);
+    }
+}
+
+uint i2c_init(i2c_inst_t *i2c, uint baudrate) {
+    host_sdk_record(host_sdk_call_i2c_init, i2c_hw_index(i2c), baudrate, 0);
+    i2c->baudrate = baudrate;
+    i2c->hw->enable = 1;
+    i2c->hw->status = I2C_IC_STATUS_TFE_BITS;
+    return baudrate;
+}
+
+// Entrega a transação e bloqueia (no relógio virtual) pelo tempo que ela ocupa o barramento
+int i2c_write_blocking(i2c_inst_t *i2c, uint8_t addr, const uint8_t *src, size_t len, bool nostop) {
+    (void)nostop;
+
+    host_sdk_i2c_deliver(i2c, addr, src, len);
+    host_sdk_advance_us(host_sdk_i2c_bus_time_us(i2c, len));
+    return (int)len;
+}
@@ -0,0 +1,51 @@
+#include <string.h>
+#include "pico/stdlib.h"
+#include "hardware/pwm.h"
+#include "host_sdk_internal.h"
+
+// Valores de reset do RP2040: divisor 1,0, TOP = 0xFFFF, níveis em 0 e fatia desabilitada
+#define pwm_reset_slice {.div16 = 16, .wrap = 0xFFFF}
+
+static const host_sdk_pwm_slice_t reset_slices[NUM_PWM_SLICES] = {
+    pwm_reset_slice, pwm_reset_slice, pwm_reset_slice, pwm_reset_slice,
+    pwm_reset_slice, pwm_reset_slice, pwm_reset_slice, pwm_reset_slice,
+};
+
+static host_sdk_pwm_slice_t slices[NUM_PWM_SLICES] = {
+    pwm_reset_slice, pwm_reset_slice, pwm_reset_slice, pwm_reset_slice,
+    pwm_reset_slice, pwm_reset_slice, pwm_reset_slice, pwm_reset_slice,
+};
+
+void host_sdk_pwm_reset(void) {
+    memcpy(slices, reset_slices, sizeof(slices));
+}
+
+void pwm_set_clkdiv_int_frac(uint slice_num, uint8_t integer, uint8_t fract) {
+    uint16_t div16 = (uint16_t)((integer << 4) | (fract & 0x0F));
+
+    host_sdk_record(host_sdk_call_pwm_set_clkdiv, slice_num, div16, 0);
+    slices[slice_num].div16 = div16;
+}
+
+void pwm_set_wrap(uint slice_num, uint16_t wrap) {
+    host_sdk_record(host_sdk_call_pwm_set_wrap, slice_num, wrap, 0);
+    slices[slice_num].wrap = wrap;
+}
+
+void pwm_set_chan_level(uint slice_num, uint chan, uint16_t level) {
+    host_sdk_record(host_sdk_call_pwm_set_level, slice_num, chan, level);
+    slices[slice_num].level[chan] = level;
+}
+
+void pwm_set_gpio_level(uint gpio, uint16_t level) {
+    pwm_set_chan_level(pwm_gpio_to_slice_num(gpio), pwm_gpio_to_channel(gpio), level);
+}
+
+void pwm_set_enabled(uint slice_num, bool enabled) {
+    host_sdk_record(host_sdk_call_pwm_set_enabled, slice_num, enabled, 0);
+    slices[slice_num].enabled = enabled;
+}
+
+const host_sdk_pwm_slice_t *host_sdk_pwm_slice(uint slice_num) {
+    return &slices[slice_num];
+}
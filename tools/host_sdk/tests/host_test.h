@@ -0,0 +1,77 @@
+// Apoio aos testes do computador (host): verificações que contam falhas e captura das transações I2C
+//
+// Cada teste é um executável que retorna 0 se todas as verificações passarem (ctest --test-dir <build>).
+#pragma once
+
+#include <stdio.h>
+#include <string.h>
+#include "host_sdk.h"
+
+#define host_test_max_transactions 64
+#define host_test_max_bytes 1100 // Controle + quadro inteiro + folga
+
+// Transações I2C recebidas desde host_test_capture_start
+typedef struct {
+    int count;
+    size_t total_bytes;
+    struct {
+        uint8_t addr;
+        size_t length;
+        uint8_t bytes[host_test_max_bytes];
+    } transactions[host_test_max_transactions];
+} host_test_capture_t;
+
+static int host_test_failures = 0;
+static host_test_capture_t host_test_capture;
+
+#define host_test_check(condition) \
+    do { \
+        if (!(condition)) { \
+            printf("%s:%d: falhou: %s\n", __FILE__, __LINE__, #condition); \
+            host_test_failures++; \
+        } \
+    } while (0)
+
+#define host_test_check_int(actual, expected) \
+    do { \
+        long long host_test_a = (long long)(actual), host_test_e = (long long)(expected); \
+        if (host_test_a != host_test_e) { \
+            printf("%s:%d: falhou: %s == %lld (esperado %lld)\n", __FILE__, __LINE__, #actual, host_test_a, host_test_e); \
+            host_test_failures++; \
+        } \
+    } while (0)
+
+static void host_test_i2c_hook(i2c_inst_t *i2c, uint8_t addr, const uint8_t *bytes, size_t length, void *user_data) {
+    host_test_capture_t *capture = user_data;
+
+    capture->total_bytes += length;
+    if (capture->count < host_test_max_transactions && length <= host_test_max_bytes) {
+        capture->transactions[capture->count].addr = addr;
+        capture->transactions[capture->count].length = length;
+        memcpy(capture->transactions[capture->count].bytes, bytes, length);
+    }
+    capture->count++;
+}
+
+// Passa a guardar as transações I2C (descartando as anteriores)
+static inline void host_test_capture_start(void) {
+    memset(&host_test_capture, 0, sizeof(host_test_capture));
+    host_sdk_set_i2c_hook(host_test_i2c_hook, &host_test_capture);
+}
+
+// Compara a transação "index" com os bytes esperados
+static inline bool host_test_transaction_is(int index, const uint8_t *expected, size_t length) {
+    return index < host_test_capture.count && index < host_test_max_transactions &&
+           host_test_capture.transactions[index].length == length &&
+           memcmp(host_test_capture.transactions[index].bytes, expected, length) == 0;
+}
+
+// Resultado do executável: imprime o resumo e retorna o código de saída
+static inline int host_test_finish(const char *name) {
+    if (host_test_failures) {
+        printf("%s: %d falha(s)\n", name, host_test_failures);
+        return 1;
+    }
+    printf("%s: ok\n", name);
+    return 0;
+}
@@ -0,0 +1,203 @@
+// Envio assíncrono: o fim do envio por DMA (e o callback de latência) só vem com o barramento ocioso,
+// um segundo envio durante o primeiro é recusado e um transporte próprio recebe as palavras do quadro
+
+#include <stdlib.h>
+#include "pico/stdlib.h"
+#include "hardware/i2c.h"
+#include "ssd1306.h"
+#include "host_test.h"
+
+static ssd1306_double_buffer_t db;
+static uint64_t last_delivery_us;
+static uint64_t callback_us;
+static int callbacks;
+
+static void delivery_hook(i2c_inst_t *i2c, uint8_t addr, const uint8_t *bytes, size_t length, void *user_data) {
+    last_delivery_us = host_sdk_time_us();
+}
+
+static void frame_sent(void *user_data) {
+    callback_us = host_sdk_time_us();
+    callbacks++;
+    host_test_check(!ssd1306_async_busy());
+}
+
+// O callback não pode vir no fim do DMA (FIFO ainda com bytes), só depois do último byte no barramento
+static void test_callback_after_bus_idle() {
+    uint64_t start_us = host_sdk_time_us();
+
+    memset(db.back.data, 0x55, ssd1306_buffer_length);
+    host_test_check(ssd1306_present_async(&db, frame_sent, NULL));
+    host_test_check(ssd1306_async_busy());
+
+    // Fim do DMA: o quadro ainda está saindo pelo barramento
+    while (host_sdk_call_count(host_sdk_call_dma_complete) == 0) {
+        tight_loop_contents();
+    }
+    host_test_check_int(callbacks, 0);
+    host_test_check(ssd1306_async_busy());
+
+    ssd1306_async_wait();
+    host_test_check_int(callbacks, 1);
+    host_test_check(callback_us >= last_delivery_us);
+    host_test_check(callback_us - last_delivery_us <= 25);
+
+    // Quadro inteiro: uma transação de janela e uma de 1024 bytes
+    uint32_t bus_us = host_sdk_i2c_bus_time_us(i2c1, 7) + host_sdk_i2c_bus_time_us(i2c1, 1 + ssd1306_buffer_length);
+    host_test_check(callback_us - start_us >= bus_us);
+}
+
+// Uma escrita bloqueante durante o envio espera o DMA e o barramento esvaziarem
+static void test_blocking_write_waits() {
+    ssd1306_t bm;
+
+    db.back.data[0] ^= 0xFF;
+    callbacks = 0;
+    host_test_check(ssd1306_present_async(&db, frame_sent, NULL));
+
+    host_test_capture_start();
+    ssd1306_init_bm(&bm, ssd1306_width, ssd1306_height, false, ssd1306_i2c_address, i2c1);
+    ssd1306_command(&bm, ssd1306_set_display | 0x01);
+
+    // A janela e o byte alterado saem antes do comando, que vem por último e inteiro
+    const uint8_t command[] = {0x80, ssd1306_set_display | 0x01};
+    host_test_check_int(callbacks, 1);
+    host_test_check_int(host_test_capture.count, 3);
+    host_test_check(host_test_transaction_is(2, command, sizeof(command)));
+    free(bm.ram_buffer);
+}
+
+static void other_sent(void *user_data) {
+    host_test_check(false); // Envio recusado: o callback dele nunca pode ser chamado
+}
+
+// Um segundo envio durante o primeiro é recusado sem mexer em nada: o primeiro chega inteiro ao barramento,
+// o framebuffer recusado mantém as faixas sujas e o double buffer recusado não é sincronizado
+static void test_second_send_refused() {
+    static ssd1306_framebuffer_t first, second;
+    struct render_area frame = {
+        .start_column = 0,
+        .end_column = ssd1306_width - 1,
+        .start_page = 0,
+        .end_page = ssd1306_n_pages - 1
+    };
+    ssd1306_context_t ctx;
+
+    calculate_render_area_buffer_length(&frame);
+    ssd1306_framebuffer_init(&first);
+    ssd1306_framebuffer_init(&second);
+    for (int i = 0; i < ssd1306_buffer_length; i++) {
+        first.data[i] = (uint8_t)(i * 13 + 1);
+    }
+    ssd1306_ctx_init_framebuffer(&ctx, &second);
+    ssd1306_ctx_fill_rect(&ctx, 10, 10, 20, 20, true);
+
+    db.back.data[100] ^= 0xFF;
+    uint8_t front = db.front[100];
+
+    callbacks = 0;
+    host_test_capture_start();
+    host_test_check(render_framebuffer_on_display_async(&first, &frame, frame_sent, NULL));
+
+    // Redesenhar o quadro em envio não altera o que vai ao barramento (as palavras já foram montadas)
+    uint8_t expected[1 + ssd1306_buffer_length];
+    expected[0] = 0x40;
+    memcpy(expected + 1, first.data, ssd1306_buffer_length);
+    memset(first.data, 0, ssd1306_buffer_length);
+
+    host_test_check(!render_framebuffer_on_display_async(&second, &frame, other_sent, NULL));
+    host_test_check(!render_framebuffer_dirty_on_display_async(&second, other_sent, NULL));
+    host_test_check(!render_framebuffer_areas_on_display_async(&second, &frame, 1, other_sent, NULL));
+    host_test_check(!ssd1306_present_async(&db, other_sent, NULL));
+    host_test_check(second.dirty.pages[1].is_dirty);
+    host_test_check_int(db.front[100], front);
+
+    ssd1306_async_wait();
+    host_test_check_int(callbacks, 1);
+    host_test_check_int(host_test_capture.count, 2);
+    host_test_check(host_test_transaction_is(1, expected, sizeof(expected)));
+
+    // Com o barramento livre, o envio recusado pode ser feito
+    host_test_check(ssd1306_present_async(&db, NULL, NULL));
+    ssd1306_async_wait();
+    host_test_check_int(db.front[100], db.back.data[100]);
+}
+
+// Transporte simulado: guarda as palavras e só conclui quando o teste mandar
+static uint16_t transport_words[16];
+static size_t transport_count;
+static int transport_starts, transport_waits;
+
+static void transport_start(const uint16_t *words, size_t count) {
+    transport_starts++;
+    transport_count = count;
+    memcpy(transport_words, words, (count < count_of(transport_words) ? count : count_of(transport_words)) * sizeof(uint16_t));
+}
+
+static void transport_wait_idle(void) {
+    transport_waits++;
+}
+
+// O envio usa o transporte informado em ssd1306_async_init, no formato de IC_DATA_CMD, e termina quando
+// ele chama ssd1306_async_transfer_complete
+static void test_custom_transport() {
+    static const ssd1306_transport_t transport = {
+        .start = transport_start,
+        .wait_idle = transport_wait_idle,
+    };
+    static ssd1306_framebuffer_t fb;
+    struct render_area area = {
+        .start_column = 40,
+        .end_column = 42,
+        .start_page = 2,
+        .end_page = 2
+    };
+
+    ssd1306_async_init(&transport);
+    calculate_render_area_buffer_length(&area);
+    ssd1306_framebuffer_init(&fb);
+    fb.data[2 * ssd1306_width + 40] = 0xA1;
+    fb.data[2 * ssd1306_width + 41] = 0xB2;
+    fb.data[2 * ssd1306_width + 42] = 0xC3;
+
+    callbacks = 0;
+    host_test_capture_start();
+    host_test_check(render_framebuffer_on_display_async(&fb, &area, frame_sent, NULL));
+    host_test_check_int(transport_starts, 1);
+    host_test_check(ssd1306_async_busy());
+    host_test_check(!render_framebuffer_on_display_async(&fb, &area, frame_sent, NULL));
+    host_test_check_int(transport_starts, 1);
+
+    const uint16_t expected[] = {
+        0x00, ssd1306_set_column_address, 40, 42, ssd1306_set_page_address, 2, 2 | I2C_IC_DATA_CMD_STOP_BITS,
+        0x40, 0xA1, 0xB2, 0xC3 | I2C_IC_DATA_CMD_STOP_BITS
+    };
+    host_test_check_int(transport_count, count_of(expected));
+    host_test_check(memcmp(transport_words, expected, sizeof(expected)) == 0);
+
+    // Nada passa pelo I2C do SDK: quem envia é o transporte
+    host_test_check_int(host_test_capture.count, 0);
+
+    ssd1306_async_transfer_complete();
+    host_test_check_int(callbacks, 1);
+    host_test_check(!ssd1306_async_busy());
+
+    ssd1306_async_wait();
+    host_test_check(transport_waits >= 1);
+}
+
+int main() {
+    host_sdk_reset();
+    host_sdk_set_i2c_hook(delivery_hook, NULL);
+    i2c_init(i2c1, ssd1306_i2c_clock * 1000);
+
+    ssd1306_double_buffer_init(&db);
+    ssd1306_async_init(NULL);
+
+    test_callback_after_bus_idle();
+    test_blocking_write_waits();
+    test_second_send_refused();
+    test_custom_transport();
+
+    return host_test_finish("test_async");
+}
@@ -0,0 +1,76 @@
+// buzzer_tone_config: erro de frequência de 20 Hz a 20 kHz e tabela pré-calculada
+
+#include "pico/stdlib.h"
+#include "buzzer.h"
+#include "host_test.h"
+
+// Erro máximo aceito a 125 MHz: o arredondamento de wrap erra até meia contagem em (wrap + 1),
+// e a 20 kHz o divisor mínimo (1,0) deixa 6250 contagens por período
+#define max_error_ppm_125mhz 85.0
+
+// Varre 20 Hz a 20 kHz com um clock; retorna o maior erro relativo (ppm) e confere cada configuração
+static double sweep(uint32_t clk_hz) {
+    double worst = 0;
+
+    for (uint32_t freq = 20; freq <= 20000; freq++) {
+        uint16_t div16, wrap;
+        uint32_t achieved = buzzer_tone_config(clk_hz, freq, &div16, &wrap);
+
+        host_test_check(div16 >= 16 && div16 <= 4095);
+
+        // Frequência exata da configuração: clk / ((div16 / 16) * (wrap + 1))
+        double exact = (double)clk_hz * 16.0 / ((double)div16 * ((double)wrap + 1.0));
+        double error_ppm = (exact - freq) / freq * 1e6;
+        if (error_ppm < 0) {
+            error_ppm = -error_ppm;
+        }
+        if (error_ppm > worst) {
+            worst = error_ppm;
+        }
+
+        // Limite teórico de cada tom: meia contagem de wrap (mais o arredondamento do alvo)
+        host_test_check(error_ppm <= 0.5e6 / ((double)wrap + 1.0) + 1e6 / ((double)clk_hz * 16.0 / freq) + 1e-6);
+
+        // O valor retornado é a frequência obtida, arredondada para Hz
+        host_test_check(achieved + 1 >= exact && achieved <= exact + 1);
+    }
+    return worst;
+}
+
+// Com clk_sys igual ao da tabela, as notas saem da tabela com os mesmos valores do cálculo na hora
+static void test_table_matches() {
+    static const uint16_t notes[] = {
+        NOTE_C4, NOTE_D4, NOTE_E4, NOTE_F4, NOTE_G4, NOTE_A4, NOTE_B4, 500, NOTE_C5, NOTE_D5, NOTE_E5,
+        NOTE_F5, NOTE_G5, NOTE_A5, NOTE_B5, 1000, NOTE_C6, 1200, NOTE_E6, NOTE_G6, 2000, NOTE_C7, 4000,
+    };
+
+    for (size_t i = 0; i < count_of(notes); i++) {
+        buzzer_note_t note = {notes[i], 100, 50};
+        buzzer_step_t step;
+        uint16_t div16, wrap;
+
+        buzzer_prepare_step(&note, &step);
+        buzzer_tone_config(BUZZER_TABLE_CLOCK_HZ, notes[i], &div16, &wrap);
+
+        host_test_check_int(step.div_int, div16 >> 4);
+        host_test_check_int(step.div_frac, div16 & 0x0F);
+        host_test_check_int(step.wrap, wrap);
+        host_test_check_int(step.level, (wrap + 1u) / 2u);
+    }
+}
+
+int main() {
+    host_sdk_reset();
+
+    double worst = sweep(125000000u);
+    printf("125 MHz: erro máximo %.1f ppm\n", worst);
+    host_test_check(worst <= max_error_ppm_125mhz);
+
+    // Outros clk_sys comuns: o erro continua dentro do limite teórico de cada tom
+    sweep(133000000u);
+    sweep(48000000u);
+
+    test_table_matches();
+
+    return host_test_finish("test_buzzer_tone");
+}
@@ -0,0 +1,124 @@
+// Faixas sujas: bytes enviados por render_dirty_on_display e independência entre framebuffers
+
+#include "pico/stdlib.h"
+#include "hardware/i2c.h"
+#include "ssd1306.h"
+#include "host_test.h"
+
+static uint8_t ssd[ssd1306_buffer_length];
+static ssd1306_dirty_t ssd_dirty;
+static ssd1306_context_t ctx; // Desenha em ssd acumulando as faixas em ssd_dirty
+
+// Envia o quadro inteiro (deixa todas as faixas limpas)
+static void render_frame(uint8_t *buffer) {
+    struct render_area frame = {
+        .start_column = 0,
+        .end_column = ssd1306_width - 1,
+        .start_page = 0,
+        .end_page = ssd1306_n_pages - 1
+    };
+    calculate_render_area_buffer_length(&frame);
+    render_on_display(buffer, &frame);
+    ssd1306_mark_area_clean(&ssd_dirty, &frame);
+}
+
+// Só o rodapé muda: uma janela de comandos e as 23 colunas do texto, 31 bytes no total
+static void test_single_region() {
+    ssd1306_clear(ssd);
+    ssd1306_draw_string(ssd, 5, ssd1306_height - 8, "1/4");
+    render_frame(ssd);
+
+    ssd1306_ctx_clear_rect(&ctx, 5, ssd1306_height - 8, 3 * 8, 8);
+    ssd1306_ctx_draw_string_font(&ctx, 5, ssd1306_height - 8, "2/4", &ssd1306_font_8x8, ssd1306_draw_opaque);
+
+    host_test_capture_start();
+    render_dirty_on_display(ssd, &ssd_dirty);
+
+    const uint8_t window[] = {
+        0x00,
+        ssd1306_set_column_address, 5, 27,
+        ssd1306_set_page_address, 7, 7
+    };
+    uint8_t data[1 + 23];
+    data[0] = 0x40;
+    memcpy(data + 1, ssd + 7 * ssd1306_width + 5, 23);
+
+    host_test_check_int(host_test_capture.count, 2);
+    host_test_check_int(host_test_capture.total_bytes, 31);
+    host_test_check(host_test_transaction_is(0, window, sizeof(window)));
+    host_test_check(host_test_transaction_is(1, data, sizeof(data)));
+    host_test_check(host_test_capture.transactions[0].addr == ssd1306_i2c_address);
+
+    // Nada mudou desde o envio: nada vai ao barramento
+    host_test_capture_start();
+    render_dirty_on_display(ssd, &ssd_dirty);
+    host_test_check_int(host_test_capture.count, 0);
+}
+
+// Desenhar em buffers auxiliares (sem faixas ou de outro framebuffer) não suja o buffer enviado
+static void test_independent_buffers() {
+    static uint8_t scratch[ssd1306_buffer_length];
+    static ssd1306_framebuffer_t a, b;
+    ssd1306_context_t a_ctx;
+
+    ssd1306_framebuffer_init(&a);
+    ssd1306_framebuffer_init(&b);
+    ssd1306_ctx_init_framebuffer(&a_ctx, &a);
+    render_frame(ssd);
+
+    ssd1306_draw_string(scratch, 0, 0, "cache");
+    ssd1306_ctx_draw_line(&a_ctx, 0, 0, 127, 63, true);
+
+    host_test_capture_start();
+    render_dirty_on_display(ssd, &ssd_dirty);
+    render_framebuffer_dirty_on_display(&b);
+    host_test_check_int(host_test_capture.count, 0);
+
+    // O framebuffer desenhado envia uma janela por página tocada pela linha
+    render_framebuffer_dirty_on_display(&a);
+    host_test_check_int(host_test_capture.count, 2 * ssd1306_n_pages);
+
+    // As funções que recebem só os pixels não marcam faixas: o buffer não acumula nada
+    ssd1306_draw_string(ssd, 0, 0, "x");
+    host_test_capture_start();
+    render_dirty_on_display(ssd, &ssd_dirty);
+    host_test_check_int(host_test_capture.count, 0);
+}
+
+// Cada framebuffer carrega as próprias faixas: não há limite de quantos são acompanhados ao mesmo tempo
+static void test_many_framebuffers() {
+    static ssd1306_framebuffer_t frames[8];
+
+    for (int i = 0; i < (int)count_of(frames); i++) {
+        ssd1306_context_t frame_ctx;
+
+        ssd1306_framebuffer_init(&frames[i]);
+        ssd1306_ctx_init_framebuffer(&frame_ctx, &frames[i]);
+        ssd1306_ctx_set_pixel(&frame_ctx, i, 8 * (i % ssd1306_n_pages), true);
+    }
+
+    for (int i = 0; i < (int)count_of(frames); i++) {
+        host_test_capture_start();
+        render_framebuffer_dirty_on_display(&frames[i]);
+        host_test_check_int(host_test_capture.count, 2);
+        host_test_check_int(host_test_capture.total_bytes, 7 + 2);
+    }
+
+    // ssd1306_framebuffer_clear marca as colunas apagadas
+    ssd1306_framebuffer_clear(&frames[0]);
+    host_test_capture_start();
+    render_framebuffer_dirty_on_display(&frames[0]);
+    host_test_check_int(host_test_capture.count, 2);
+}
+
+int main() {
+    host_sdk_reset();
+    ssd1306_ctx_init(&ctx, ssd);
+    ctx.dirty = &ssd_dirty;
+
+    test_single_region();
+    test_independent_buffers();
+    test_many_framebuffers();
+
+    return host_test_finish("test_dirty");
+}
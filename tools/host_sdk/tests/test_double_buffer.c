@@ -0,0 +1,133 @@
+// ssd1306_double_buffer_diff e ssd1306_present sobre pares back/front sintéticos
+
+#include "pico/stdlib.h"
+#include "hardware/i2c.h"
+#include "ssd1306.h"
+#include "host_test.h"
+
+static ssd1306_double_buffer_t db;
+static struct render_area areas[ssd1306_max_diff_areas];
+
+// Verifica uma área de uma página só
+static void check_area(const struct render_area *area, int page, int start_column, int end_column) {
+    host_test_check_int(area->start_page, page);
+    host_test_check_int(area->end_page, page);
+    host_test_check_int(area->start_column, start_column);
+    host_test_check_int(area->end_column, end_column);
+    host_test_check_int(area->buffer_length, end_column - start_column + 1);
+}
+
+// Verifica as duas transações de uma janela parcial enviada por ssd1306_present, a partir de "index"
+static void check_sent_window(int index, int page, int start_column, int end_column) {
+    const uint8_t window[] = {
+        0x00,
+        ssd1306_set_column_address, start_column, end_column,
+        ssd1306_set_page_address, page, page
+    };
+    static uint8_t data[1 + ssd1306_width];
+    int length = end_column - start_column + 1;
+
+    data[0] = 0x40;
+    memcpy(data + 1, db.back.data + page * ssd1306_width + start_column, length);
+
+    host_test_check(host_test_transaction_is(index, window, sizeof(window)));
+    host_test_check(host_test_transaction_is(index + 1, data, length + 1));
+}
+
+// Reinicia o par com o mesmo conteúdo em back e front
+static void reset_pair(uint8_t fill) {
+    ssd1306_double_buffer_init(&db);
+    memset(db.back.data, fill, ssd1306_buffer_length);
+    memset(db.front, fill, ssd1306_buffer_length);
+}
+
+static void test_identical() {
+    reset_pair(0xA5);
+    host_test_check_int(ssd1306_double_buffer_diff(&db, areas), 0);
+
+    host_test_capture_start();
+    ssd1306_present(&db);
+    host_test_check_int(host_test_capture.count, 0);
+}
+
+static void test_one_byte() {
+    reset_pair(0x00);
+    db.back.data[3 * ssd1306_width + 40] = 0x18;
+
+    host_test_check_int(ssd1306_double_buffer_diff(&db, areas), 1);
+    check_area(&areas[0], 3, 40, 40);
+
+    host_test_capture_start();
+    ssd1306_present(&db);
+    host_test_check_int(host_test_capture.count, 2);
+    host_test_check_int(host_test_capture.total_bytes, 7 + 2);
+    check_sent_window(0, 3, 40, 40);
+
+    // Depois do envio, front é igual a back
+    host_test_check(memcmp(db.front, db.back.data, ssd1306_buffer_length) == 0);
+    host_test_check_int(ssd1306_double_buffer_diff(&db, areas), 0);
+}
+
+// Até ssd1306_diff_merge_gap bytes iguais entre dois trechos: uma área só
+static void test_gap_merges() {
+    reset_pair(0x00);
+    db.back.data[1 * ssd1306_width + 10] = 0xFF;
+    db.back.data[1 * ssd1306_width + 10 + ssd1306_diff_merge_gap + 1] = 0xFF;
+
+    host_test_check_int(ssd1306_double_buffer_diff(&db, areas), 1);
+    check_area(&areas[0], 1, 10, 10 + ssd1306_diff_merge_gap + 1);
+
+    host_test_capture_start();
+    ssd1306_present(&db);
+    host_test_check_int(host_test_capture.count, 2);
+    check_sent_window(0, 1, 10, 10 + ssd1306_diff_merge_gap + 1);
+}
+
+// Mais de ssd1306_diff_merge_gap bytes iguais: duas áreas, duas janelas
+static void test_gap_splits() {
+    reset_pair(0x00);
+    db.back.data[1 * ssd1306_width + 10] = 0xFF;
+    db.back.data[1 * ssd1306_width + 10 + ssd1306_diff_merge_gap + 2] = 0xFF;
+
+    host_test_check_int(ssd1306_double_buffer_diff(&db, areas), 2);
+    check_area(&areas[0], 1, 10, 10);
+    check_area(&areas[1], 1, 10 + ssd1306_diff_merge_gap + 2, 10 + ssd1306_diff_merge_gap + 2);
+
+    host_test_capture_start();
+    ssd1306_present(&db);
+    host_test_check_int(host_test_capture.count, 4);
+    check_sent_window(0, 1, 10, 10);
+    check_sent_window(2, 1, 10 + ssd1306_diff_merge_gap + 2, 10 + ssd1306_diff_merge_gap + 2);
+}
+
+// Página inteira alterada: uma área de 128 colunas, enviada numa única transação de dados
+static void test_full_page() {
+    reset_pair(0x00);
+    for (int x = 0; x < ssd1306_width; x++) {
+        db.back.data[5 * ssd1306_width + x] = (uint8_t)(x + 1);
+    }
+
+    host_test_check_int(ssd1306_double_buffer_diff(&db, areas), 1);
+    check_area(&areas[0], 5, 0, ssd1306_width - 1);
+
+    host_test_capture_start();
+    ssd1306_present(&db);
+    host_test_check_int(host_test_capture.count, 2);
+    host_test_check_int(host_test_capture.total_bytes, 7 + 1 + ssd1306_width);
+    check_sent_window(0, 5, 0, ssd1306_width - 1);
+
+    // O byte antes da página (fim da página 4) não pode ter sido trocado pelo byte de controle
+    host_test_check_int(db.back.data[5 * ssd1306_width - 1], 0x00);
+}
+
+int main() {
+    host_sdk_reset();
+
+    test_identical();
+    test_one_byte();
+    test_gap_merges();
+    test_gap_splits();
+    test_full_page();
+
+    return host_test_finish("test_double_buffer");
+}
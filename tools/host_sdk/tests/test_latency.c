@@ -0,0 +1,44 @@
+// ssd1306_latency_record e ssd1306_latency_read: soma de 64 bits, máximo e sequência da gravação
+
+#include "pico/stdlib.h"
+#include "ssd1306.h"
+#include "host_test.h"
+
+// Registra um quadro que levou elapsed_us desde o evento
+static void record(ssd1306_latency_t *stats, uint32_t elapsed_us) {
+    uint32_t start_us = time_us_32();
+
+    host_sdk_advance_us(elapsed_us);
+    ssd1306_latency_record(stats, start_us);
+}
+
+int main() {
+    static ssd1306_latency_t stats;
+    ssd1306_latency_t snapshot;
+
+    host_sdk_reset();
+
+    record(&stats, 1500);
+    ssd1306_latency_read(&stats, &snapshot);
+    host_test_check_int(snapshot.frames, 1);
+    host_test_check_int(snapshot.last_us, 1500);
+    host_test_check_int(snapshot.max_us, 1500);
+    host_test_check(snapshot.total_us == 1500);
+
+    // Cada gravação deixa a sequência par (nenhuma gravação em andamento) e a avança
+    host_test_check_int(snapshot.sequence & 1, 0);
+    uint32_t sequence = snapshot.sequence;
+
+    // A soma passa de 32 bits sem perder a parte alta
+    record(&stats, 0xF0000000u);
+    record(&stats, 0x20000000u);
+    record(&stats, 700);
+    ssd1306_latency_read(&stats, &snapshot);
+    host_test_check_int(snapshot.frames, 4);
+    host_test_check_int(snapshot.last_us, 700);
+    host_test_check(snapshot.max_us == 0xF0000000u);
+    host_test_check(snapshot.total_us == 1500ull + 0xF0000000ull + 0x20000000ull + 700);
+    host_test_check(snapshot.sequence == sequence + 6);
+
+    return host_test_finish("test_latency");
+}
@@ -0,0 +1,126 @@
+// ssd1306_ctx_draw_line: mesmos pixels e mesmas faixas sujas que o Bresenham de um pixel por vez,
+// inclusive com pontas fora da tela e apagando sobre um quadro já desenhado
+
+#include <stdlib.h>
+#include "pico/stdlib.h"
+#include "hardware/i2c.h"
+#include "ssd1306.h"
+#include "host_test.h"
+
+#define line_count 20000
+
+static uint8_t expected[ssd1306_buffer_length];
+static ssd1306_dirty_t expected_dirty;
+static ssd1306_framebuffer_t frame;
+
+// Referência: cada pixel do Bresenham que cai na tela, marcando a coluna só se o byte mudar
+static void reference_pixel(int x, int y, bool set) {
+    if (x < 0 || x >= ssd1306_width || y < 0 || y >= ssd1306_height) {
+        return;
+    }
+
+    uint8_t *byte = &expected[(y / 8) * ssd1306_width + x];
+    uint8_t value = set ? *byte | (1 << (y % 8)) : *byte & ~(1 << (y % 8));
+    if (value == *byte) {
+        return;
+    }
+    *byte = value;
+
+    int page = y / 8;
+    if (!expected_dirty.pages[page].is_dirty) {
+        expected_dirty.pages[page].is_dirty = true;
+        expected_dirty.pages[page].min_column = x;
+        expected_dirty.pages[page].max_column = x;
+    }
+    else if (x < expected_dirty.pages[page].min_column) {
+        expected_dirty.pages[page].min_column = x;
+    }
+    else if (x > expected_dirty.pages[page].max_column) {
+        expected_dirty.pages[page].max_column = x;
+    }
+}
+
+static void reference_line(int x_0, int y_0, int x_1, int y_1, bool set) {
+    int dx = abs(x_1 - x_0);
+    int dy = -abs(y_1 - y_0);
+    int sx = x_0 < x_1 ? 1 : -1;
+    int sy = y_0 < y_1 ? 1 : -1;
+    int error = dx + dy;
+
+    while (true) {
+        reference_pixel(x_0, y_0, set);
+        if (x_0 == x_1 && y_0 == y_1) {
+            break;
+        }
+
+        int error_2 = 2 * error;
+        if (error_2 >= dy) {
+            error += dy;
+            x_0 += sx;
+        }
+        if (error_2 <= dx) {
+            error += dx;
+            y_0 += sy;
+        }
+    }
+}
+
+// Faixas sujas iguais às da referência; exact = false aceita faixas maiores (linhas horizontais vão por
+// ssd1306_fill_row, que marca de 4 em 4 colunas)
+static bool same_dirty(bool exact) {
+    for (int page = 0; page < ssd1306_n_pages; page++) {
+        bool dirty = frame.dirty.pages[page].is_dirty;
+        int min_column = frame.dirty.pages[page].min_column;
+        int max_column = frame.dirty.pages[page].max_column;
+        int expected_min = expected_dirty.pages[page].min_column;
+        int expected_max = expected_dirty.pages[page].max_column;
+
+        if (dirty != expected_dirty.pages[page].is_dirty) {
+            return false;
+        }
+        if (dirty && exact && (min_column != expected_min || max_column != expected_max)) {
+            return false;
+        }
+        if (dirty && (min_column > expected_min || max_column < expected_max)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Coordenada aleatória com margem de 40 pixels fora da tela
+static int random_coordinate(int size) {
+    return rand() % (size + 80) - 40;
+}
+
+int main() {
+    ssd1306_context_t ctx;
+    int failures = 0;
+
+    ssd1306_framebuffer_init(&frame);
+    ssd1306_ctx_init_framebuffer(&ctx, &frame);
+
+    srand(1);
+    for (int i = 0; i < line_count; i++) {
+        int x_0 = random_coordinate(ssd1306_width), y_0 = random_coordinate(ssd1306_height);
+        int x_1 = random_coordinate(ssd1306_width), y_1 = random_coordinate(ssd1306_height);
+        bool set = rand() % 3 != 0; // Acende mais do que apaga, para sobrar pixel aceso a apagar
+
+        // Cada linha começa com as faixas limpas, sobre o que as anteriores deixaram no quadro
+        ssd1306_clear_dirty(&frame.dirty);
+        memset(&expected_dirty, 0, sizeof(expected_dirty));
+
+        ssd1306_ctx_draw_line(&ctx, x_0, y_0, x_1, y_1, set);
+        reference_line(x_0, y_0, x_1, y_1, set);
+
+        if (memcmp(frame.data, expected, sizeof(expected)) != 0 || !same_dirty(y_0 != y_1)) {
+            if (failures++ < 5) {
+                printf("linha (%d, %d) -> (%d, %d), set %d difere da referência\n", x_0, y_0, x_1, y_1, set);
+            }
+            memcpy(frame.data, expected, sizeof(expected));
+        }
+    }
+
+    host_test_check_int(failures, 0);
+    return host_test_finish("test_line");
+}
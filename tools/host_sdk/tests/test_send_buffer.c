@@ -0,0 +1,50 @@
+// ssd1306_send_buffer: quadro inteiro em transações de uma página, sem cópia estática, e tamanhos inválidos
+
+#include "pico/stdlib.h"
+#include "hardware/i2c.h"
+#include "ssd1306.h"
+#include "host_test.h"
+
+static uint8_t ssd[ssd1306_buffer_length];
+
+int main() {
+    host_sdk_reset();
+    i2c_init(i2c1, ssd1306_i2c_clock * 1000);
+
+    for (int i = 0; i < ssd1306_buffer_length; i++) {
+        ssd[i] = (uint8_t)(i * 7 + 3);
+    }
+
+    // Quadro inteiro: uma transação por página, cada uma com o byte de controle e os 128 bytes da página
+    host_test_capture_start();
+    host_test_check(ssd1306_send_buffer(ssd, ssd1306_buffer_length));
+    host_test_check_int(host_test_capture.count, ssd1306_n_pages);
+    host_test_check_int(host_test_capture.total_bytes, ssd1306_buffer_length + ssd1306_n_pages);
+    for (int page = 0; page < ssd1306_n_pages; page++) {
+        uint8_t expected[1 + ssd1306_width];
+
+        expected[0] = 0x40;
+        memcpy(expected + 1, ssd + page * ssd1306_width, ssd1306_width);
+        host_test_check(host_test_transaction_is(page, expected, sizeof(expected)));
+    }
+
+    // Trecho menor que uma página: uma transação só
+    host_test_capture_start();
+    host_test_check(ssd1306_send_buffer(ssd + 5, 23));
+    host_test_check_int(host_test_capture.count, 1);
+    host_test_check_int(host_test_capture.total_bytes, 24);
+
+    // Um byte além de uma página: vai sozinho numa segunda transação
+    host_test_capture_start();
+    host_test_check(ssd1306_send_buffer(ssd, ssd1306_width + 1));
+    host_test_check_int(host_test_capture.count, 2);
+    host_test_check_int(host_test_capture.transactions[1].length, 2);
+
+    // Maior que o quadro (ou negativo): recusado sem nada no barramento
+    host_test_capture_start();
+    host_test_check(!ssd1306_send_buffer(ssd, ssd1306_buffer_length + 1));
+    host_test_check(!ssd1306_send_buffer(ssd, -1));
+    host_test_check_int(host_test_capture.count, 0);
+
+    return host_test_finish("test_send_buffer");
+}
@@ -0,0 +1,109 @@
+// Formas: o triângulo preenchido cobre o próprio contorno; formas fora do recorte não mexem no quadro
+
+#include <stdlib.h>
+#include "pico/stdlib.h"
+#include "hardware/i2c.h"
+#include "ssd1306.h"
+#include "host_test.h"
+
+#define triangle_count 20000
+
+static uint8_t outline[ssd1306_buffer_length];
+static uint8_t filled[ssd1306_buffer_length];
+
+// Pixels do contorno que o preenchimento deixou apagados
+static int uncovered_pixels() {
+    int count = 0;
+
+    for (int i = 0; i < ssd1306_buffer_length; i++) {
+        count += __builtin_popcount(outline[i] & ~filled[i]);
+    }
+    return count;
+}
+
+static bool fill_covers_outline(int x_0, int y_0, int x_1, int y_1, int x_2, int y_2) {
+    memset(outline, 0, sizeof(outline));
+    memset(filled, 0, sizeof(filled));
+    ssd1306_draw_triangle(outline, x_0, y_0, x_1, y_1, x_2, y_2, true);
+    ssd1306_fill_triangle(filled, x_0, y_0, x_1, y_1, x_2, y_2, true);
+    return uncovered_pixels() == 0;
+}
+
+// Triângulos aleatórios na tela e com vértices fora dela (o recorte não pode deslocar as arestas)
+static void test_fill_covers_outline() {
+    int failures = 0;
+
+    // Caso da revisão: aresta íngreme com vários pixels por coluna
+    host_test_check(fill_covers_outline(24, 21, 36, 47, 26, 8));
+
+    srand(1);
+    for (int i = 0; i < triangle_count; i++) {
+        int margin = i < triangle_count / 2 ? 0 : 64;
+        int x[3], y[3];
+
+        for (int v = 0; v < 3; v++) {
+            x[v] = rand() % (ssd1306_width + 2 * margin) - margin;
+            y[v] = rand() % (ssd1306_height + 2 * margin) - margin;
+        }
+        if (!fill_covers_outline(x[0], y[0], x[1], y[1], x[2], y[2])) {
+            if (failures++ < 5) {
+                printf("  contorno descoberto: (%d,%d) (%d,%d) (%d,%d)\n", x[0], y[0], x[1], y[1], x[2], y[2]);
+            }
+        }
+    }
+    host_test_check_int(failures, 0);
+
+    // Degenerados: um ponto, uma linha vertical, uma horizontal e vértices repetidos
+    host_test_check(fill_covers_outline(10, 10, 10, 10, 10, 10));
+    host_test_check(fill_covers_outline(10, 2, 10, 60, 10, 30));
+    host_test_check(fill_covers_outline(3, 40, 120, 40, 50, 40));
+    host_test_check(fill_covers_outline(5, 5, 90, 50, 5, 5));
+}
+
+// Preenchimento só dentro do triângulo: nenhuma coluna fora das pontas nem pixel acima/abaixo da caixa
+static void test_fill_stays_in_box() {
+    memset(filled, 0, sizeof(filled));
+    ssd1306_fill_triangle(filled, 20, 10, 100, 30, 40, 50, true);
+
+    for (int y = 0; y < ssd1306_height; y++) {
+        for (int x = 0; x < ssd1306_width; x++) {
+            bool lit = (filled[(y / 8) * ssd1306_width + x] >> (y % 8)) & 1;
+            if (lit && (x < 20 || x > 100 || y < 10 || y > 50)) {
+                host_test_check(!lit);
+                return;
+            }
+        }
+    }
+}
+
+// Formas com a caixa toda fora do recorte não desenham nada (nem com raios enormes)
+static void test_outside_clip() {
+    ssd1306_context_t ctx;
+
+    memset(filled, 0, sizeof(filled));
+    ssd1306_ctx_init(&ctx, filled);
+    ssd1306_ctx_push_clip(&ctx, 32, 16, 64, 32);
+
+    ssd1306_ctx_fill_triangle(&ctx, 0, 0, 30, 0, 10, 60, true);
+    ssd1306_ctx_fill_circle(&ctx, 110, 30, 10, true);
+    ssd1306_ctx_draw_ellipse(&ctx, 60, -1000, 20, 900, true);
+    ssd1306_ctx_fill_round_rect(&ctx, 0, 50, 128, 14, 4, true);
+    ssd1306_ctx_draw_rect(&ctx, 100, 0, 20, 64, true);
+
+    static const uint8_t empty[ssd1306_buffer_length];
+    host_test_check(memcmp(filled, empty, sizeof(empty)) == 0);
+
+    // Elipse enorme que cruza a tela: termos de erro em 64 bits, semieixos limitados
+    ssd1306_fill_ellipse(filled, 64, 32, 100000, 100000, true);
+    host_test_check(filled[0] == 0xFF && filled[ssd1306_buffer_length - 1] == 0xFF);
+}
+
+int main() {
+    host_sdk_reset();
+
+    test_fill_covers_outline();
+    test_fill_stays_in_box();
+    test_outside_clip();
+
+    return host_test_finish("test_shapes");
+}
@@ -0,0 +1,140 @@
+// Pré-renderizador de páginas (roda no computador, não na placa)
+//
+// Rasteriza o corpo de cada página de inc/pages.c com o mesmo código de desenho do firmware
+// (inc/ssd1306_draw.c) e grava os quadros prontos para enviar ao display num cabeçalho const,
+// que o firmware inclui (pages_baked.h) para não rodar o renderizador de texto nas telas estáticas.
+//
+// Uso: page_baker [--rle] <saida.h>
+//   --rle  compacta cada quadro (ver ssd1306_rle_decode); sem ele, cada página ocupa 1 KB de flash
+//
+// Antes de gravar, cada quadro codificado é decodificado e comparado byte a byte com a renderização
+// (ida e volta do RLE); qualquer diferença interrompe o build. O caminho do firmware que lê o cabeçalho
+// (pages_draw_body com PAGES_BAKED) é conferido à parte, por page_baker_check.c.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "hardware/i2c.h"
+#include "ssd1306.h"
+#include "pages.h"
+
+// Pior caso do RLE: só literais (1 byte de cabeçalho a cada 128)
+#define max_encoded_length (ssd1306_buffer_length + ssd1306_buffer_length / 128 + 1)
+
+// Tamanho da repetição de bytes iguais a partir de src[0] (no máximo 128)
+static int run_length(const uint8_t *src, int remaining) {
+    int n = 1;
+    while (n < remaining && n < 128 && src[n] == src[0]) {
+        n++;
+    }
+    return n;
+}
+
+// Compacta um quadro no formato lido por ssd1306_rle_decode; repetições de 3 bytes ou mais viram um bloco
+static int rle_encode(const uint8_t *src, int length, uint8_t *out) {
+    int size = 0;
+    int i = 0;
+
+    while (i < length) {
+        int run = run_length(src + i, length - i);
+        if (run >= 3) {
+            out[size++] = (uint8_t)(0x80 | (run - 1));
+            out[size++] = src[i];
+            i += run;
+            continue;
+        }
+
+        // Literal: segue até o início da próxima repetição que valha a pena (ou 128 bytes)
+        int start = i;
+        while (i < length && i - start < 128 && run_length(src + i, length - i) < 3) {
+            i++;
+        }
+        out[size++] = (uint8_t)(i - start - 1);
+        memcpy(out + size, src + start, i - start);
+        size += i - start;
+    }
+    return size;
+}
+
+static void write_bytes(FILE *out, const uint8_t *bytes, int length) {
+    for (int i = 0; i < length; i++) {
+        fprintf(out, "%s0x%02x,", i % 16 ? " " : "\n    ", bytes[i]);
+    }
+}
+
+int main(int argc, char **argv) {
+    bool rle = false;
+    const char *output = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--rle") == 0) {
+            rle = true;
+        } else {
+            output = argv[i];
+        }
+    }
+    if (!output) {
+        fprintf(stderr, "uso: page_baker [--rle] <saida.h>\n");
+        return 1;
+    }
+
+    FILE *out = fopen(output, "w");
+    if (!out) {
+        fprintf(stderr, "page_baker: não foi possível criar %s\n", output);
+        return 1;
+    }
+
+    static uint8_t frame[ssd1306_buffer_length];
+    static uint8_t decoded[ssd1306_buffer_length];
+    static uint8_t encoded[max_encoded_length];
+    int offsets[NUM_PAGES + 1];
+    int total = 0;
+
+    fprintf(out, "// Gerado por tools/page_baker a partir de inc/pages.c; não edite\n");
+    fprintf(out, "#define PAGES_BAKED_RLE %d\n\n", rle ? 1 : 0);
+    fprintf(out, "static const uint8_t pages_baked_data[] = {");
+
+    for (int page = 0; page < NUM_PAGES; page++) {
+        pages_render_body(frame, page);
+
+        const uint8_t *bytes = frame;
+        int length = ssd1306_buffer_length;
+        if (rle) {
+            length = rle_encode(frame, ssd1306_buffer_length, encoded);
+            bytes = encoded;
+        }
+
+        // Confere o quadro gravado contra a renderização em tempo de execução, decodificando como o firmware
+        if (rle) {
+            ssd1306_rle_decode(encoded, decoded, ssd1306_buffer_length);
+        } else {
+            memcpy(decoded, bytes, ssd1306_buffer_length);
+        }
+        pages_render_body(frame, page);
+        if (memcmp(decoded, frame, ssd1306_buffer_length) != 0) {
+            fprintf(stderr, "page_baker: o quadro gravado da página %d difere da renderização\n", page + 1);
+            fclose(out);
+            remove(output);
+            return 1;
+        }
+
+        fprintf(out, "\n    // Página %d (%d bytes)", page + 1, length);
+        write_bytes(out, bytes, length);
+        offsets[page] = total;
+        total += length;
+    }
+    offsets[NUM_PAGES] = total;
+
+    fprintf(out, "\n};\n\n");
+    fprintf(out, "// Início do quadro de cada página em pages_baked_data (o último marca o fim)\n");
+    fprintf(out, "static const uint16_t pages_baked_offsets[] = {");
+    for (int page = 0; page <= NUM_PAGES; page++) {
+        fprintf(out, "%s%d", page ? ", " : "", offsets[page]);
+    }
+    fprintf(out, "};\n");
+
+    fclose(out);
+    printf("page_baker: %d páginas, %d bytes%s\n", NUM_PAGES, total, rle ? " (RLE)" : "");
+    return 0;
+}
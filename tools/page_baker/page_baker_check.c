@@ -0,0 +1,49 @@
+// Confere o cabeçalho gerado pelo page_baker com o caminho do firmware (roda no computador)
+//
+// Este executável compila inc/pages.c com PAGES_BAKED, exatamente como o firmware, contra um
+// pages_baked.h recém-gerado: pages_draw_body decodifica os quadros da "flash" (RLE ou cópia, com
+// PAGES_BODY_LENGTH) e o resultado de cada página é comparado com pages_render_body. O rodapé que já
+// estiver no buffer (última página) não pode ser tocado.
+//
+// Retorna 0 se todas as páginas conferem e 1 na primeira diferença.
+
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "hardware/i2c.h"
+#include "ssd1306.h"
+#include "pages.h"
+
+int main() {
+    static uint8_t expected[ssd1306_buffer_length];
+    static uint8_t drawn[ssd1306_buffer_length];
+    int failures = 0;
+
+    pages_init();
+
+    for (int page = 0; page < NUM_PAGES; page++) {
+        pages_render_body(expected, page);
+
+        // Buffer sujo, como na troca de página: o corpo deve ser sobrescrito e o rodapé mantido
+        memset(drawn, 0xA5, sizeof(drawn));
+        pages_draw_body(drawn, page);
+
+        if (memcmp(drawn, expected, PAGES_BODY_LENGTH) != 0) {
+            fprintf(stderr, "page_baker_check: o corpo da página %d difere da renderização\n", page + 1);
+            failures++;
+        }
+        for (int i = PAGES_BODY_LENGTH; i < ssd1306_buffer_length; i++) {
+            if (drawn[i] != 0xA5) {
+                fprintf(stderr, "page_baker_check: a página %d escreveu no rodapé (byte %d)\n", page + 1, i);
+                failures++;
+                break;
+            }
+        }
+    }
+
+    if (failures) {
+        return 1;
+    }
+    printf("page_baker_check: %d páginas conferem com pages_draw_body\n", NUM_PAGES);
+    return 0;
+}
@@ -0,0 +1,181 @@
+// Roda o driver do display (inc/ssd1306_i2c.c) no computador contra o emulador do SSD1306
+//
+// Executa ssd1306_init, um quadro inteiro (render_framebuffer_on_display), um quadro só com as colunas alteradas
+// (render_dirty_on_display), a rolagem (ssd1306_scroll) e o caminho do bitmap (ssd1306_config +
+// ssd1306_draw_bitmap, em endereçamento vertical). Depois de cada etapa, a imagem do painel emulado é
+// comparada pixel a pixel com o framebuffer; os bytes de barramento de cada quadro são impressos.
+//
+// Uso: ssd1306_emulator [-p pagina] [-o saida.png|saida.pbm] [-s escala] [-m max_bytes_por_quadro]
+//   -p  página de inc/pages.c desenhada (padrão 0)
+//   -o  grava a imagem do painel após o quadro inteiro
+//   -s  ampliação do PNG (padrão 4)
+//   -m  falha se algum quadro precisar de mais bytes de barramento que isso (para o CI)
+//
+// Retorna 0 se tudo confere e 1 em qualquer divergência ou limite excedido.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "hardware/i2c.h"
+#include "ssd1306.h"
+#include "pages.h"
+#include "ssd1306_emulator.h"
+
+static ssd1306_emulator_t emu;
+static uint32_t max_frame_bytes = 0;
+static int failures = 0;
+
+// Imprime e zera o tráfego acumulado desde a última etapa; confere o limite de bytes por quadro
+static void report(const char *name, bool frame) {
+    const ssd1306_emulator_stats_t *stats = &emu.stats;
+
+    printf("%-30s %3u transações %5u bytes (%u comandos, %4u dados) %6u us a %d kHz\n",
+           name, stats->transactions, stats->bytes, stats->command_bytes, stats->data_bytes,
+           ssd1306_emulator_bus_time_us(stats, ssd1306_i2c_clock), ssd1306_i2c_clock);
+
+    if (stats->unknown_commands) {
+        printf("  %u comandos desconhecidos\n", stats->unknown_commands);
+        failures++;
+    }
+    if (frame && max_frame_bytes && stats->bytes > max_frame_bytes) {
+        printf("  acima do limite de %u bytes por quadro\n", max_frame_bytes);
+        failures++;
+    }
+    ssd1306_emulator_reset_stats(&emu);
+}
+
+// Compara a imagem do painel com um quadro no formato do framebuffer (página, coluna)
+static void check(const char *name, const uint8_t *ssd) {
+    static uint8_t image[ssd1306_emulator_height][ssd1306_emulator_width];
+    int differences = 0;
+
+    ssd1306_emulator_render(&emu, image);
+    for (int y = 0; y < ssd1306_height; y++) {
+        for (int x = 0; x < ssd1306_width; x++) {
+            uint8_t expected = (ssd[(y / 8) * ssd1306_width + x] >> (y % 8)) & 1;
+            differences += image[y][x] != expected;
+        }
+    }
+
+    if (differences) {
+        printf("  %s: %d pixels diferentes do framebuffer\n", name, differences);
+        failures++;
+    }
+}
+
+int main(int argc, char **argv) {
+    const char *output = NULL;
+    int page_index = 0;
+    int scale = 4;
+
+    for (int i = 1; i < argc; i++) {
+        if (i + 1 < argc && strcmp(argv[i], "-o") == 0) {
+            output = argv[++i];
+        }
+        else if (i + 1 < argc && strcmp(argv[i], "-s") == 0) {
+            scale = atoi(argv[++i]);
+        }
+        else if (i + 1 < argc && strcmp(argv[i], "-p") == 0) {
+            page_index = atoi(argv[++i]);
+        }
+        else if (i + 1 < argc && strcmp(argv[i], "-m") == 0) {
+            max_frame_bytes = (uint32_t)strtoul(argv[++i], NULL, 0);
+        }
+        else {
+            fprintf(stderr, "uso: %s [-p pagina] [-o saida.png|saida.pbm] [-s escala] [-m max_bytes_por_quadro]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (page_index < 0 || page_index >= NUM_PAGES) {
+        fprintf(stderr, "página inválida: %d (0 a %d)\n", page_index, NUM_PAGES - 1);
+        return 1;
+    }
+
+    static ssd1306_framebuffer_t frame;
+    ssd1306_framebuffer_init(&frame);
+    uint8_t *ssd = frame.data;
+    ssd1306_context_t ctx;
+    ssd1306_ctx_init_framebuffer(&ctx, &frame);
+    struct render_area frame_area = {
+        .start_column = 0,
+        .end_column = ssd1306_width - 1,
+        .start_page = 0,
+        .end_page = ssd1306_n_pages - 1
+    };
+    calculate_render_area_buffer_length(&frame_area);
+
+    ssd1306_emulator_init(&emu, ssd1306_i2c_address);
+    ssd1306_emulator_attach(&emu);
+
+    ssd1306_init();
+    report("ssd1306_init", false);
+
+    // Quadro inteiro: corpo da página e rodapé
+    pages_render_body(ssd, page_index);
+    ssd1306_draw_string(ssd, 5, ssd1306_height - 8, "1/4");
+    render_framebuffer_on_display(&frame, &frame_area);
+    report("render_framebuffer_on_display", true);
+    check("render_framebuffer_on_display", ssd);
+
+    if (output) {
+        size_t length = strlen(output);
+        bool pbm = length >= 4 && strcmp(output + length - 4, ".pbm") == 0;
+        bool saved = pbm ? ssd1306_emulator_save_pbm(&emu, output) : ssd1306_emulator_save_png(&emu, output, scale);
+        if (!saved) {
+            fprintf(stderr, "não foi possível gravar %s\n", output);
+            failures++;
+        }
+    }
+
+    // Só o rodapé muda: vão ao barramento apenas as colunas sujas
+    ssd1306_ctx_clear_rect(&ctx, 5, ssd1306_height - 8, 3 * 8, 8);
+    ssd1306_ctx_draw_string_font(&ctx, 5, ssd1306_height - 8, "2/4", &ssd1306_font_8x8, ssd1306_draw_opaque);
+    render_dirty_on_display(ssd, &frame.dirty);
+    report("render_dirty_on_display", true);
+    check("render_dirty_on_display", ssd);
+
+    // Rolagem horizontal para a direita das páginas 0 a 3, um passo a cada 5 quadros
+    ssd1306_scroll(true);
+    ssd1306_emulator_step(&emu, 5);
+    ssd1306_scroll(false);
+    report("ssd1306_scroll", false);
+    {
+        static uint8_t scrolled[ssd1306_buffer_length];
+        memcpy(scrolled, ssd, sizeof(scrolled));
+        for (int page = 0; page <= 3; page++) {
+            uint8_t *row = scrolled + page * ssd1306_width;
+            memmove(row + 1, ssd + page * ssd1306_width, ssd1306_width - 1);
+            row[0] = ssd[page * ssd1306_width + ssd1306_width - 1];
+        }
+        check("ssd1306_scroll", scrolled);
+    }
+
+    // Caminho do bitmap: endereçamento vertical, bytes de cada coluna em sequência
+    static uint8_t bitmap[ssd1306_buffer_length];
+    for (int x = 0; x < ssd1306_width; x++) {
+        for (int page = 0; page < ssd1306_n_pages; page++) {
+            bitmap[x * ssd1306_n_pages + page] = (uint8_t)~ssd[page * ssd1306_width + x];
+        }
+    }
+    ssd1306_t bm;
+    ssd1306_init_bm(&bm, ssd1306_width, ssd1306_height, false, ssd1306_i2c_address, i2c1);
+    ssd1306_config(&bm);
+    report("ssd1306_config", false);
+    ssd1306_draw_bitmap(&bm, bitmap);
+    report("ssd1306_draw_bitmap", true);
+    {
+        static uint8_t inverted[ssd1306_buffer_length];
+        for (size_t i = 0; i < ssd1306_buffer_length; i++) {
+            inverted[i] = (uint8_t)~ssd[i];
+        }
+        check("ssd1306_draw_bitmap", inverted);
+    }
+    free(bm.ram_buffer);
+
+    if (failures) {
+        printf("%d falha(s)\n", failures);
+        return 1;
+    }
+    return 0;
+}
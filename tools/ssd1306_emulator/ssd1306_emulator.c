@@ -0,0 +1,471 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ssd1306_emulator.h"
+
+// Intervalo entre passos de rolagem, em quadros, para cada código de 3 bits (tabela do 0x26/0x27)
+static const uint16_t scroll_intervals[8] = {5, 64, 128, 256, 3, 4, 25, 2};
+
+// Estado após o reset do controlador (valores da folha de dados); a GDDRAM não é apagada no reset,
+// mas aqui começa zerada para que as comparações sejam reproduzíveis
+void ssd1306_emulator_init(ssd1306_emulator_t *emu, uint8_t address) {
+    memset(emu, 0, sizeof(*emu));
+    emu->address = address;
+    emu->mode = ssd1306_emulator_page;
+    emu->column_end = ssd1306_emulator_width - 1;
+    emu->page_end = ssd1306_emulator_pages - 1;
+    emu->mux_ratio = ssd1306_emulator_height - 1;
+    emu->contrast = 0x7F;
+    emu->com_pins = 0x12;
+    emu->clock_divide = 0x80;
+    emu->precharge = 0x22;
+    emu->vcomh = 0x20;
+    emu->vertical_area_rows = ssd1306_emulator_height;
+}
+
+void ssd1306_emulator_reset_stats(ssd1306_emulator_t *emu) {
+    memset(&emu->stats, 0, sizeof(emu->stats));
+}
+
+// Quantidade de parâmetros que seguem cada comando (0 para comandos de um só byte)
+static int ssd1306_emulator_parameter_count(uint8_t command) {
+    switch (command) {
+    case 0x20: case 0x81: case 0x8D: case 0xA8: case 0xD3:
+    case 0xD5: case 0xD9: case 0xDA: case 0xDB:
+        return 1;
+    case 0x21: case 0x22: case 0xA3:
+        return 2;
+    case 0x29: case 0x2A:
+        return 5;
+    case 0x26: case 0x27:
+        return 6;
+    default:
+        return 0;
+    }
+}
+
+// Grava um byte na GDDRAM e avança o ponteiro conforme o modo de endereçamento
+static void ssd1306_emulator_data(ssd1306_emulator_t *emu, uint8_t value) {
+    emu->gddram[emu->page][emu->column] = value;
+    emu->stats.data_bytes++;
+
+    switch (emu->mode) {
+    case ssd1306_emulator_horizontal:
+        // Fim da janela de colunas: volta ao início e desce uma página (da última volta à primeira)
+        if (emu->column++ >= emu->column_end) {
+            emu->column = emu->column_start;
+            emu->page = emu->page >= emu->page_end ? emu->page_start : emu->page + 1;
+        }
+        break;
+    case ssd1306_emulator_vertical:
+        if (emu->page++ >= emu->page_end) {
+            emu->page = emu->page_start;
+            emu->column = emu->column >= emu->column_end ? emu->column_start : emu->column + 1;
+        }
+        break;
+    default:
+        // Modo página: a coluna volta ao início e a página não muda
+        if (emu->column++ >= ssd1306_emulator_width - 1) {
+            emu->column = emu->page_column;
+        }
+        break;
+    }
+}
+
+// Executa um comando completo (com todos os parâmetros em emu->command)
+static void ssd1306_emulator_execute(ssd1306_emulator_t *emu) {
+    const uint8_t *c = emu->command;
+
+    if (c[0] <= 0x1F) {
+        // Nibble baixo/alto da coluna inicial; só vale no modo página
+        if (c[0] <= 0x0F) {
+            emu->page_column = (uint8_t)((emu->page_column & 0xF0) | c[0]);
+        }
+        else {
+            emu->page_column = (uint8_t)(((c[0] & 0x07) << 4) | (emu->page_column & 0x0F));
+        }
+        if (emu->mode == ssd1306_emulator_page) {
+            emu->column = emu->page_column;
+        }
+        return;
+    }
+    if (c[0] >= 0x40 && c[0] <= 0x7F) {
+        emu->start_line = c[0] & 0x3F;
+        return;
+    }
+    if (c[0] >= 0xB0 && c[0] <= 0xB7) {
+        if (emu->mode == ssd1306_emulator_page) {
+            emu->page = c[0] & 0x07;
+        }
+        return;
+    }
+
+    switch (c[0]) {
+    case 0x20:
+        // 0b11 é inválido e não altera o modo
+        if ((c[1] & 0x03) != 0x03) {
+            emu->mode = (ssd1306_emulator_mode_t)(c[1] & 0x03);
+        }
+        break;
+    case 0x21:
+        emu->column_start = c[1] & 0x7F;
+        emu->column_end = c[2] & 0x7F;
+        emu->column = emu->column_start;
+        break;
+    case 0x22:
+        emu->page_start = c[1] & 0x07;
+        emu->page_end = c[2] & 0x07;
+        emu->page = emu->page_start;
+        break;
+    case 0x26: case 0x27: case 0x29: case 0x2A:
+        emu->scroll_command = c[0];
+        emu->scroll_start_page = c[2] & 0x07;
+        emu->scroll_interval = c[3] & 0x07;
+        emu->scroll_end_page = c[4] & 0x07;
+        emu->scroll_vertical_step = (c[0] == 0x29 || c[0] == 0x2A) ? (c[5] & 0x3F) : 0;
+        break;
+    case 0x2E:
+        emu->scroll_active = false;
+        emu->vertical_scroll = 0;
+        break;
+    case 0x2F:
+        emu->scroll_active = emu->scroll_command != 0;
+        emu->scroll_frames = 0;
+        break;
+    case 0x81:
+        emu->contrast = c[1];
+        break;
+    case 0x8D:
+        emu->charge_pump = (c[1] & 0x04) != 0;
+        break;
+    case 0xA0: case 0xA1:
+        emu->segment_remap = c[0] & 0x01;
+        break;
+    case 0xA3:
+        emu->vertical_area_top = c[1] & 0x3F;
+        emu->vertical_area_rows = c[2] & 0x7F;
+        break;
+    case 0xA4: case 0xA5:
+        emu->entire_on = c[0] & 0x01;
+        break;
+    case 0xA6: case 0xA7:
+        emu->inverse = c[0] & 0x01;
+        break;
+    case 0xA8:
+        // Valores abaixo de 15 são inválidos e ignorados
+        if ((c[1] & 0x3F) >= 15) {
+            emu->mux_ratio = c[1] & 0x3F;
+        }
+        break;
+    case 0xAE: case 0xAF:
+        emu->display_on = c[0] & 0x01;
+        break;
+    case 0xC0: case 0xC8:
+        emu->com_reversed = (c[0] & 0x08) != 0;
+        break;
+    case 0xD3:
+        emu->display_offset = c[1] & 0x3F;
+        break;
+    case 0xD5:
+        emu->clock_divide = c[1];
+        break;
+    case 0xD9:
+        emu->precharge = c[1];
+        break;
+    case 0xDA:
+        emu->com_pins = c[1];
+        break;
+    case 0xDB:
+        emu->vcomh = c[1];
+        break;
+    case 0xE3:
+        // NOP
+        break;
+    default:
+        emu->stats.unknown_commands++;
+        break;
+    }
+}
+
+// Um byte de comando: inicia um comando novo ou completa os parâmetros do anterior
+static void ssd1306_emulator_command(ssd1306_emulator_t *emu, uint8_t value) {
+    emu->stats.command_bytes++;
+
+    if (emu->command_length == 0) {
+        emu->command_expected = (uint8_t)ssd1306_emulator_parameter_count(value);
+    }
+    emu->command[emu->command_length++] = value;
+
+    if (emu->command_length > emu->command_expected) {
+        ssd1306_emulator_execute(emu);
+        emu->command_length = 0;
+    }
+}
+
+// Uma transação I2C completa, sem o byte de endereço (como em i2c_write_blocking)
+// Cada byte de controle diz se o que segue é comando (D/C# = 0) ou dado (D/C# = 1) e, com Co = 1,
+// que só o próximo byte é coberto por ele; com Co = 0, ele vale até o fim da transação
+void ssd1306_emulator_write(ssd1306_emulator_t *emu, uint8_t address, const uint8_t *bytes, size_t length) {
+    if (address != emu->address) {
+        emu->stats.ignored++;
+        return;
+    }
+
+    emu->stats.transactions++;
+    emu->stats.bytes += (uint32_t)length;
+
+    size_t i = 0;
+    while (i < length) {
+        uint8_t control = bytes[i++];
+        bool data = (control & 0x40) != 0;
+        size_t end = (control & 0x80) ? (i < length ? i + 1 : i) : length;
+
+        emu->stats.control_bytes++;
+
+        for (; i < end; i++) {
+            if (data) {
+                ssd1306_emulator_data(emu, bytes[i]);
+            }
+            else {
+                ssd1306_emulator_command(emu, bytes[i]);
+            }
+        }
+    }
+}
+
+// Gira uma coluna, nas páginas da rolagem, para a direita (0x26/0x29) ou para a esquerda (0x27/0x2A)
+// Como no controlador, a rolagem altera a própria GDDRAM
+static void ssd1306_emulator_scroll_columns(ssd1306_emulator_t *emu) {
+    bool right = emu->scroll_command == 0x26 || emu->scroll_command == 0x29;
+
+    for (int page = emu->scroll_start_page; page <= emu->scroll_end_page; page++) {
+        uint8_t *row = emu->gddram[page];
+
+        if (right) {
+            uint8_t last = row[ssd1306_emulator_width - 1];
+            memmove(row + 1, row, ssd1306_emulator_width - 1);
+            row[0] = last;
+        }
+        else {
+            uint8_t first = row[0];
+            memmove(row, row + 1, ssd1306_emulator_width - 1);
+            row[ssd1306_emulator_width - 1] = first;
+        }
+    }
+}
+
+// Avança o tempo em quadros (a cada quadro o painel é varrido uma vez); só a rolagem depende dele
+void ssd1306_emulator_step(ssd1306_emulator_t *emu, uint32_t frames) {
+    if (!emu->scroll_active) {
+        return;
+    }
+
+    while (frames--) {
+        if (++emu->scroll_frames % scroll_intervals[emu->scroll_interval] != 0) {
+            continue;
+        }
+
+        ssd1306_emulator_scroll_columns(emu);
+        if (emu->scroll_vertical_step && emu->vertical_area_rows) {
+            emu->vertical_scroll = (uint8_t)((emu->vertical_scroll + emu->scroll_vertical_step) % emu->vertical_area_rows);
+        }
+    }
+}
+
+// Linha da varredura (0 a mux_ratio) que acende a linha y do vidro, ou -1 se ela fica apagada
+// O painel é o módulo 128x64 comum: ligado para a configuração alternativa dos pinos COM (0xDA 0x12),
+// com COM63 na linha de cima; assim, A1 + C8 (como em ssd1306_init) mostram a imagem em pé
+static int ssd1306_emulator_scan_row(const ssd1306_emulator_t *emu, int y) {
+    int row = y;
+
+    // Configuração sequencial num painel ligado para a alternativa: linhas entrelaçadas
+    if (!(emu->com_pins & 0x10)) {
+        row = (y & 1) * (ssd1306_emulator_height / 2) + y / 2;
+    }
+    // Remapeamento esquerda/direita dos COM: troca as metades
+    if (emu->com_pins & 0x20) {
+        row ^= ssd1306_emulator_height / 2;
+    }
+
+    int pin = ssd1306_emulator_height - 1 - row;
+    int lines = emu->mux_ratio + 1;
+    int scan = emu->com_reversed ? lines - 1 - pin : pin;
+
+    return (scan >= 0 && scan < lines) ? scan : -1;
+}
+
+// Imagem vista no painel: 1 = pixel aceso
+void ssd1306_emulator_render(const ssd1306_emulator_t *emu, uint8_t image[ssd1306_emulator_height][ssd1306_emulator_width]) {
+    for (int y = 0; y < ssd1306_emulator_height; y++) {
+        int scan = ssd1306_emulator_scan_row(emu, y);
+
+        if (scan < 0 || !emu->display_on || !emu->charge_pump) {
+            memset(image[y], 0, ssd1306_emulator_width);
+            continue;
+        }
+
+        // Área de rolagem vertical (0xA3)
+        int top = emu->vertical_area_top;
+        int rows = emu->vertical_area_rows;
+        if (scan >= top && scan < top + rows) {
+            scan = top + (scan - top + emu->vertical_scroll) % rows;
+        }
+        int ram_row = (scan + emu->start_line + emu->display_offset) % ssd1306_emulator_height;
+
+        for (int x = 0; x < ssd1306_emulator_width; x++) {
+            int column = emu->segment_remap ? x : ssd1306_emulator_width - 1 - x;
+            uint8_t pixel = (emu->gddram[ram_row / 8][column] >> (ram_row % 8)) & 1;
+
+            if (emu->entire_on) {
+                pixel = 1;
+            }
+            if (emu->inverse) {
+                pixel ^= 1;
+            }
+            image[y][x] = pixel;
+        }
+    }
+}
+
+// Tempo de barramento do tráfego contado: START + endereço + STOP por transação e 9 bits (com ACK) por byte
+uint32_t ssd1306_emulator_bus_time_us(const ssd1306_emulator_stats_t *stats, uint32_t clock_khz) {
+    uint64_t bits = (uint64_t)stats->transactions * (9 + 2) + (uint64_t)stats->bytes * 9;
+    return (uint32_t)((bits * 1000 + clock_khz - 1) / clock_khz);
+}
+
+// PBM binário (P4): 1 = preto, então os pixels acesos saem claros sobre o fundo escuro, como no painel
+bool ssd1306_emulator_save_pbm(const ssd1306_emulator_t *emu, const char *path) {
+    static uint8_t image[ssd1306_emulator_height][ssd1306_emulator_width];
+    FILE *out = fopen(path, "wb");
+
+    if (!out) {
+        return false;
+    }
+
+    ssd1306_emulator_render(emu, image);
+    fprintf(out, "P4\n%d %d\n", ssd1306_emulator_width, ssd1306_emulator_height);
+
+    for (int y = 0; y < ssd1306_emulator_height; y++) {
+        for (int x = 0; x < ssd1306_emulator_width; x += 8) {
+            uint8_t packed = 0;
+            for (int bit = 0; bit < 8; bit++) {
+                packed |= (uint8_t)(!image[y][x + bit] << (7 - bit));
+            }
+            fputc(packed, out);
+        }
+    }
+
+    return fclose(out) == 0;
+}
+
+static uint32_t png_crc(uint32_t crc, const uint8_t *bytes, size_t length) {
+    crc = ~crc;
+    for (size_t i = 0; i < length; i++) {
+        crc ^= bytes[i];
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xEDB88320u & -(crc & 1));
+        }
+    }
+    return ~crc;
+}
+
+static void png_put_u32(uint8_t *out, uint32_t value) {
+    out[0] = (uint8_t)(value >> 24);
+    out[1] = (uint8_t)(value >> 16);
+    out[2] = (uint8_t)(value >> 8);
+    out[3] = (uint8_t)value;
+}
+
+static void png_chunk(FILE *out, const char *type, const uint8_t *data, size_t length) {
+    uint8_t header[8];
+
+    png_put_u32(header, (uint32_t)length);
+    memcpy(header + 4, type, 4);
+    fwrite(header, 1, 8, out);
+    fwrite(data, 1, length, out);
+
+    uint8_t crc[4];
+    png_put_u32(crc, png_crc(png_crc(0, header + 4, 4), data, length));
+    fwrite(crc, 1, 4, out);
+}
+
+// PNG em tons de cinza de 1 bit (1 = aceso), ampliado "scale" vezes
+// Sem zlib: o fluxo comprimido usa só blocos deflate armazenados (sem compressão), que todo leitor aceita
+bool ssd1306_emulator_save_png(const ssd1306_emulator_t *emu, const char *path, int scale) {
+    static uint8_t image[ssd1306_emulator_height][ssd1306_emulator_width];
+
+    if (scale < 1) {
+        scale = 1;
+    }
+
+    int width = ssd1306_emulator_width * scale;
+    int height = ssd1306_emulator_height * scale;
+    size_t stride = (size_t)(width + 7) / 8 + 1; // Byte de filtro (0) + pixels
+    size_t raw_length = stride * height;
+    size_t blocks = (raw_length + 65534) / 65535;
+    size_t idat_length = 2 + raw_length + blocks * 5 + 4;
+    uint8_t *raw = calloc(raw_length, 1);
+    uint8_t *idat = malloc(idat_length);
+    FILE *out = fopen(path, "wb");
+
+    if (!raw || !idat || !out) {
+        free(raw);
+        free(idat);
+        if (out) {
+            fclose(out);
+        }
+        return false;
+    }
+
+    ssd1306_emulator_render(emu, image);
+    for (int y = 0; y < height; y++) {
+        uint8_t *line = raw + y * stride + 1;
+        for (int x = 0; x < width; x++) {
+            if (image[y / scale][x / scale]) {
+                line[x / 8] |= (uint8_t)(0x80 >> (x % 8));
+            }
+        }
+    }
+
+    // zlib: cabeçalho, blocos armazenados de até 65535 bytes e Adler-32 dos dados
+    size_t n = 0;
+    idat[n++] = 0x78;
+    idat[n++] = 0x01;
+    for (size_t offset = 0; offset < raw_length; offset += 65535) {
+        size_t size = raw_length - offset < 65535 ? raw_length - offset : 65535;
+        idat[n++] = offset + size == raw_length;
+        idat[n++] = (uint8_t)size;
+        idat[n++] = (uint8_t)(size >> 8);
+        idat[n++] = (uint8_t)~size;
+        idat[n++] = (uint8_t)(~size >> 8);
+        memcpy(idat + n, raw + offset, size);
+        n += size;
+    }
+
+    uint32_t a = 1, b = 0;
+    for (size_t i = 0; i < raw_length; i++) {
+        a = (a + raw[i]) % 65521;
+        b = (b + a) % 65521;
+    }
+    png_put_u32(idat + n, (b << 16) | a);
+    n += 4;
+
+    static const uint8_t signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    uint8_t ihdr[13];
+    png_put_u32(ihdr, (uint32_t)width);
+    png_put_u32(ihdr + 4, (uint32_t)height);
+    ihdr[8] = 1;  // Bits por pixel
+    ihdr[9] = 0;  // Tons de cinza
+    ihdr[10] = 0; // Deflate
+    ihdr[11] = 0; // Filtros adaptativos (todas as linhas usam o filtro 0)
+    ihdr[12] = 0; // Sem entrelaçamento
+
+    fwrite(signature, 1, sizeof(signature), out);
+    png_chunk(out, "IHDR", ihdr, sizeof(ihdr));
+    png_chunk(out, "IDAT", idat, n);
+    png_chunk(out, "IEND", NULL, 0);
+
+    free(raw);
+    free(idat);
+    return fclose(out) == 0;
+}
@@ -0,0 +1,91 @@
+// Emulador do controlador SSD1306 (roda no computador, não na placa)
+//
+// Recebe exatamente os bytes que i2c_write_blocking entregaria ao display — byte de controle
+// (0x00/0x80 para comandos, 0x40/0xC0 para dados), comandos com seus parâmetros e dados da GDDRAM —
+// e mantém o estado do controlador: modos de endereçamento, janelas de colunas/páginas, linha inicial,
+// deslocamento, remapeamento de segmentos, sentido dos COM, rolagem, inversão e liga/desliga.
+// A imagem vista no painel pode ser gravada em PBM ou PNG.
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#define ssd1306_emulator_width 128
+#define ssd1306_emulator_height 64
+#define ssd1306_emulator_pages (ssd1306_emulator_height / 8)
+
+// Modos de endereçamento (comando 0x20)
+typedef enum {
+    ssd1306_emulator_horizontal = 0,
+    ssd1306_emulator_vertical = 1,
+    ssd1306_emulator_page = 2,
+} ssd1306_emulator_mode_t;
+
+// Contagem do tráfego recebido desde ssd1306_emulator_reset_stats
+typedef struct {
+    uint32_t transactions;     // Escritas (START, endereço, ..., STOP) para o endereço do display
+    uint32_t bytes;            // Bytes após o endereço: controle + comandos + dados
+    uint32_t control_bytes;
+    uint32_t command_bytes;    // Comandos e seus parâmetros
+    uint32_t data_bytes;       // Bytes gravados na GDDRAM
+    uint32_t unknown_commands; // Comandos que o SSD1306 não reconhece (ignorados)
+    uint32_t ignored;          // Transações para outros endereços
+} ssd1306_emulator_stats_t;
+
+typedef struct {
+    uint8_t address;
+    uint8_t gddram[ssd1306_emulator_pages][ssd1306_emulator_width];
+
+    // Ponteiro de escrita e janela de endereçamento
+    ssd1306_emulator_mode_t mode;
+    uint8_t column, page;
+    uint8_t column_start, column_end; // 0x21 (modos horizontal e vertical)
+    uint8_t page_start, page_end;     // 0x22 (modos horizontal e vertical)
+    uint8_t page_column;              // Coluna inicial do modo página (0x00-0x0F e 0x10-0x1F)
+
+    // Comando cujos parâmetros ainda não chegaram (podem vir em outra transação)
+    uint8_t command[8];
+    uint8_t command_length;
+    uint8_t command_expected;
+
+    // Exibição
+    bool display_on;
+    bool inverse;
+    bool entire_on;
+    bool segment_remap;  // 0xA1: coluna 127 no SEG0
+    bool com_reversed;   // 0xC8: varredura de COM[N-1] até COM0
+    bool charge_pump;    // Módulos sem VCC externo só acendem com a bomba de carga ligada
+    uint8_t start_line;
+    uint8_t display_offset;
+    uint8_t mux_ratio;   // Linhas varridas - 1
+    uint8_t contrast;
+    uint8_t com_pins;    // Parâmetro de 0xDA
+    uint8_t clock_divide;
+    uint8_t precharge;
+    uint8_t vcomh;
+
+    // Rolagem (0x26/0x27/0x29/0x2A, 0xA3, 0x2E/0x2F)
+    bool scroll_active;
+    uint8_t scroll_command;
+    uint8_t scroll_start_page, scroll_end_page;
+    uint8_t scroll_interval;        // Quadros entre dois passos
+    uint8_t scroll_vertical_step;   // Linhas por passo (0x29/0x2A)
+    uint8_t vertical_area_top, vertical_area_rows;
+    uint8_t vertical_scroll;        // Deslocamento vertical acumulado
+    uint32_t scroll_frames;
+
+    ssd1306_emulator_stats_t stats;
+} ssd1306_emulator_t;
+
+extern void ssd1306_emulator_init(ssd1306_emulator_t *emu, uint8_t address);
+extern void ssd1306_emulator_reset_stats(ssd1306_emulator_t *emu);
+extern void ssd1306_emulator_write(ssd1306_emulator_t *emu, uint8_t address, const uint8_t *bytes, size_t length);
+extern void ssd1306_emulator_step(ssd1306_emulator_t *emu, uint32_t frames);
+extern void ssd1306_emulator_render(const ssd1306_emulator_t *emu, uint8_t image[ssd1306_emulator_height][ssd1306_emulator_width]);
+extern uint32_t ssd1306_emulator_bus_time_us(const ssd1306_emulator_stats_t *stats, uint32_t clock_khz);
+extern bool ssd1306_emulator_save_pbm(const ssd1306_emulator_t *emu, const char *path);
+extern bool ssd1306_emulator_save_png(const ssd1306_emulator_t *emu, const char *path, int scale);
+
+// Liga o I2C simulado de tools/host_sdk (escritas bloqueantes e por DMA) ao emulador; NULL desliga
+extern void ssd1306_emulator_attach(ssd1306_emulator_t *emu);
@@ -0,0 +1,15 @@
+// Barramento I2C do computador: o SDK simulado (tools/host_sdk) entrega cada transação ao emulador,
+// para que o driver (inc/ssd1306_i2c.c e o envio por DMA de inc/ssd1306_async.c) rode sem alterações e sem placa
+#include "pico/stdlib.h"
+#include "hardware/i2c.h"
+#include "host_sdk.h"
+#include "ssd1306_emulator.h"
+
+static void ssd1306_emulator_bus_write(i2c_inst_t *i2c, uint8_t addr, const uint8_t *bytes, size_t length, void *user_data) {
+    (void)i2c;
+    ssd1306_emulator_write(user_data, addr, bytes, length);
+}
+
+void ssd1306_emulator_attach(ssd1306_emulator_t *emu) {
+    host_sdk_set_i2c_hook(emu ? ssd1306_emulator_bus_write : NULL, emu);
+}